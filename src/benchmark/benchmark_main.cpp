@@ -0,0 +1,51 @@
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+
+#include "scheduler/task_scheduler.hpp"
+
+using namespace opossum;  // NOLINT
+
+namespace {
+
+constexpr auto WORKERS_FLAG = std::string_view{"--workers="};
+
+}  // namespace
+
+// Runs the benchmarks with the TaskScheduler started, so that operators, table imports, and the compression of chunks
+// process chunks in parallel as they do in the database. --workers=N sets the number of worker threads, --workers=0
+// runs everything in the benchmark thread. All other arguments are passed on to Google Benchmark.
+int main(int argc, char** argv) {
+  auto worker_count = size_t{std::max(std::thread::hardware_concurrency(), 1u)};
+  auto remaining_argc = 0;
+  for (auto arg_index = 0; arg_index < argc; ++arg_index) {
+    const auto arg = std::string_view{argv[arg_index]};
+    if (arg.starts_with(WORKERS_FLAG)) {
+      const auto value = arg.substr(WORKERS_FLAG.size());
+      const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), worker_count);
+      if (error != std::errc{} || end != value.data() + value.size()) {
+        std::cerr << "Invalid number of workers: " << value << std::endl;
+        return 1;
+      }
+      continue;
+    }
+    argv[remaining_argc++] = argv[arg_index];
+  }
+  argc = remaining_argc;
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+
+  if (worker_count > 0) TaskScheduler::get().begin(worker_count);
+  benchmark::AddCustomContext("workers", std::to_string(worker_count));
+  benchmark::RunSpecifiedBenchmarks();
+  TaskScheduler::get().finish();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#include <boost/hana/for_each.hpp>
+
+#include "benchmark/benchmark.h"
+
+#include "all_type_variant.hpp"
+#include "scheduler/task_scheduler.hpp"
+
+namespace opossum {
+
+// returns the name of the data type T as used by Table::add_column and data_type_from_string, e.g., "int" for int32_t
+template <typename T>
+std::string data_type_name() {
+  auto name = std::string{};
+  hana::for_each(data_types, [&](const auto data_type) {
+    if constexpr (hana::second(data_type) == hana::type_c<T>) name = hana::first(data_type);
+  });
+  return name;
+}
+
+// Returns the index-th value of a benchmark column. Strings are long enough not to fit into the string object itself,
+// so that their heap payload is part of the measurement.
+template <typename T>
+T benchmark_value(const size_t index) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return "benchmark_value_" + std::to_string(index);
+  } else {
+    return static_cast<T>(index);
+  }
+}
+
+// Returns size values of which distinct_count are distinct. They are not sorted, so that neither branch prediction nor
+// the order of a dictionary favor the benchmarks.
+template <typename T>
+std::pmr::vector<T> benchmark_values(const size_t size, const size_t distinct_count) {
+  auto values = std::pmr::vector<T>{};
+  values.reserve(size);
+  for (auto index = size_t{0}; index < size; ++index) {
+    values.emplace_back(benchmark_value<T>(index * 7'919 % distinct_count));
+  }
+  return values;
+}
+
+// Runs the TaskScheduler with the given number of workers, or inactive for 0 workers, for the lifetime of the scope,
+// and restores the number of workers that hyriseBenchmark was started with afterwards. Benchmarks that compare
+// worker counts create one per run, so that the threads are not started within the timed iterations.
+class SchedulerScope : private Noncopyable {
+ public:
+  explicit SchedulerScope(const size_t worker_count) : _previous_worker_count{TaskScheduler::get().worker_count()} {
+    _restart(worker_count);
+  }
+
+  ~SchedulerScope() { _restart(_previous_worker_count); }
+
+ private:
+  static void _restart(const size_t worker_count) {
+    auto& scheduler = TaskScheduler::get();
+    if (scheduler.worker_count() == worker_count) return;
+    scheduler.finish();
+    if (worker_count > 0) scheduler.begin(worker_count);
+  }
+
+  const size_t _previous_worker_count;
+};
+
+// adds runs with 0 (the scheduler is inactive), 1, 2, 4, ... workers up to one per core to a benchmark
+inline void worker_count_args(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgName("workers")->Arg(0);
+  const auto core_count = std::max(std::thread::hardware_concurrency(), 1u);
+  for (auto worker_count = 1u; worker_count < core_count; worker_count *= 2) benchmark->Arg(worker_count);
+  benchmark->Arg(core_count);
+}
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "benchmark_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto ROW_COUNT = 200'000;
+
+// a table file with an int, a long, a float, a double, and a string column, which is written once per benchmark
+class LoadTableFixture : public benchmark::Fixture {
+ public:
+  void SetUp(const benchmark::State& state) override {
+    auto file = std::ofstream{_file_name};
+    file << "a|b|c|d|e\nint|long|float|double|string\n";
+    for (auto row_id = 0; row_id < ROW_COUNT; ++row_id) {
+      file << row_id << '|' << int64_t{row_id} * 1'000'000 << '|' << row_id * 0.25f << '|' << row_id * 0.5 << '|'
+           << benchmark_value<std::string>(row_id % 1'000) << '\n';
+    }
+  }
+
+  void TearDown(const benchmark::State& state) override { std::remove(_file_name.c_str()); }
+
+ protected:
+  const std::string _file_name = std::filesystem::temp_directory_path() / "hyrise_load_table_benchmark.tbl";
+};
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(LoadTableFixture, BM_LoadTable)(benchmark::State& state) {
+  for (auto _ : state) {
+    const auto table = load_table(_file_name, static_cast<size_t>(state.range(0)));
+    benchmark::DoNotOptimize(table->row_count());
+  }
+  state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+}
+
+BENCHMARK_REGISTER_F(LoadTableFixture, BM_LoadTable)->Arg(1'000)->Arg(10'000)->Arg(100'000);
+
+}  // namespace opossum
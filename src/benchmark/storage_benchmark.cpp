@@ -0,0 +1,122 @@
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "benchmark_utils.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// a tenth of the values of a segment are distinct
+constexpr auto DISTINCT_VALUES_RATIO = size_t{10};
+
+template <typename T>
+std::shared_ptr<ValueSegment<T>> make_value_segment(const size_t size) {
+  return std::make_shared<ValueSegment<T>>(benchmark_values<T>(size, size / DISTINCT_VALUES_RATIO + 1));
+}
+
+template <typename T>
+void BM_ValueSegmentAppend(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  auto values = std::vector<AllTypeVariant>{};
+  for (const auto& value : benchmark_values<T>(size, size / DISTINCT_VALUES_RATIO + 1)) values.emplace_back(value);
+
+  for (auto _ : state) {
+    auto segment = ValueSegment<T>{};
+    for (const auto& value : values) segment.append(value);
+    benchmark::DoNotOptimize(segment.size());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+template <typename T>
+void BM_ValueSegmentSubscriptOperator(benchmark::State& state) {
+  const auto segment = make_value_segment<T>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); ++chunk_offset) {
+      benchmark::DoNotOptimize((*segment)[chunk_offset]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void BM_ValueSegmentValues(benchmark::State& state) {
+  const auto segment = make_value_segment<T>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    for (const auto& value : segment->values()) benchmark::DoNotOptimize(value);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void BM_DictionarySegmentCreate(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  const auto segment = std::static_pointer_cast<BaseSegment>(make_value_segment<T>(size));
+  for (auto _ : state) {
+    const auto dictionary_segment = DictionarySegment<T>{segment};
+    benchmark::DoNotOptimize(dictionary_segment.unique_values_count());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void BM_DictionarySegmentLowerBound(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  const auto dictionary_segment = DictionarySegment<T>{make_value_segment<T>(size)};
+  const auto search_values = benchmark_values<T>(1'024, size / DISTINCT_VALUES_RATIO + 1);
+  for (auto _ : state) {
+    for (const auto& search_value : search_values) {
+      benchmark::DoNotOptimize(dictionary_segment.lower_bound(search_value));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(search_values.size()));
+}
+
+// appends rows of an int, a double, and a string column to a table with the given target chunk size
+void BM_TableAppend(benchmark::State& state) {
+  constexpr auto ROW_COUNT = 100'000;
+  for (auto _ : state) {
+    auto table = Table{static_cast<ChunkOffset>(state.range(0))};
+    table.add_column("a", "int");
+    table.add_column("b", "double");
+    table.add_column("c", "string");
+    for (auto row_id = 0; row_id < ROW_COUNT; ++row_id) {
+      table.append({row_id, row_id * 0.5, benchmark_value<std::string>(row_id % 1'000)});
+    }
+    benchmark::DoNotOptimize(table.row_count());
+  }
+  state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+}
+
+}  // namespace
+
+#define BENCHMARK_SEGMENT_SIZES(function, type) \
+  BENCHMARK_TEMPLATE(function, type)->RangeMultiplier(10)->Range(1'000, 100'000)
+
+// clang-format off
+#define BENCHMARK_ALL_DATA_TYPES(function)                \
+  BENCHMARK_SEGMENT_SIZES(function, int32_t);             \
+  BENCHMARK_SEGMENT_SIZES(function, int64_t);             \
+  BENCHMARK_SEGMENT_SIZES(function, float);               \
+  BENCHMARK_SEGMENT_SIZES(function, double);              \
+  BENCHMARK_SEGMENT_SIZES(function, std::string)
+// clang-format on
+
+BENCHMARK_ALL_DATA_TYPES(BM_ValueSegmentAppend);
+BENCHMARK_ALL_DATA_TYPES(BM_ValueSegmentSubscriptOperator);
+BENCHMARK_ALL_DATA_TYPES(BM_ValueSegmentValues);
+BENCHMARK_ALL_DATA_TYPES(BM_DictionarySegmentCreate);
+BENCHMARK_ALL_DATA_TYPES(BM_DictionarySegmentLowerBound);
+// the largest chunk size is the default one, for which chunks grow on demand
+BENCHMARK(BM_TableAppend)->Arg(1'000)->Arg(65'535)->Arg(std::numeric_limits<ChunkOffset>::max() - 1);
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#include <map>
+#include <memory>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "benchmark_utils.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "utils/tpch_table_generator.hpp"
+
+namespace opossum {
+
+namespace {
+
+// large enough for the tables not to fit into the caches, small enough to be generated in a few seconds
+constexpr auto TPCH_SCALE_FACTOR = 0.1f;
+
+// returns an executed TableWrapper of the TPC-H table, which is generated only once
+std::shared_ptr<TableWrapper> tpch_table(const std::string& table_name) {
+  static auto tables = std::map<std::string, std::shared_ptr<TableWrapper>>{};
+  auto& table_wrapper = tables[table_name];
+  if (!table_wrapper) {
+    table_wrapper = std::make_shared<TableWrapper>(generate_tpch_table(table_name, TPCH_SCALE_FACTOR));
+    table_wrapper->execute();
+  }
+  return table_wrapper;
+}
+
+void BM_TpchGenerateLineitem(benchmark::State& state) {
+  const auto scheduler_scope = SchedulerScope{static_cast<size_t>(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(generate_tpch_table("lineitem", TPCH_SCALE_FACTOR)->row_count());
+  }
+}
+
+// the predicate of TPC-H query 6 on l_quantity, which about half of the rows satisfy
+void BM_TpchScanLineitem(benchmark::State& state) {
+  const auto lineitem = tpch_table("lineitem");
+  const auto scheduler_scope = SchedulerScope{static_cast<size_t>(state.range(0))};
+  for (auto _ : state) {
+    auto table_scan = std::make_shared<TableScan>(lineitem, ColumnID{4}, ScanType::OpLessThan, 24.0);
+    table_scan->execute();
+    benchmark::DoNotOptimize(table_scan->get_output()->row_count());
+  }
+}
+
+void BM_TpchJoinOrdersLineitem(benchmark::State& state) {
+  const auto orders = tpch_table("orders");
+  const auto lineitem = tpch_table("lineitem");
+  const auto scheduler_scope = SchedulerScope{static_cast<size_t>(state.range(0))};
+  for (auto _ : state) {
+    auto join = std::make_shared<JoinHash>(orders, lineitem, ColumnID{0}, ColumnID{0});
+    join->execute();
+    benchmark::DoNotOptimize(join->get_output()->row_count());
+  }
+}
+
+// compresses all chunks of orders with the encodings chosen by advise_encoding()
+void BM_TpchCompressOrders(benchmark::State& state) {
+  const auto scheduler_scope = SchedulerScope{static_cast<size_t>(state.range(0))};
+  for (auto _ : state) {
+    state.PauseTiming();
+    const auto orders = generate_tpch_table("orders", TPCH_SCALE_FACTOR);
+    state.ResumeTiming();
+    for (auto chunk_id = ChunkID{0}; chunk_id < orders->chunk_count(); ++chunk_id) orders->compress_chunk(chunk_id);
+    benchmark::DoNotOptimize(orders->memory_usage());
+  }
+}
+
+}  // namespace
+
+// All benchmarks run with 0 (single-threaded), 1, 2, 4, ... workers up to one per core and measure the wall time, as
+// the work of the workers does not count towards the CPU time of the benchmark thread.
+BENCHMARK(BM_TpchGenerateLineitem)->Apply(worker_count_args)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TpchScanLineitem)->Apply(worker_count_args)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TpchJoinOrdersLineitem)->Apply(worker_count_args)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TpchCompressOrders)->Apply(worker_count_args)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+}  // namespace opossum
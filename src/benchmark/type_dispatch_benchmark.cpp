@@ -0,0 +1,99 @@
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "benchmark_utils.hpp"
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the variants every type_cast benchmark converts, one per data type
+std::vector<AllTypeVariant> variants_of_all_data_types() {
+  return {AllTypeVariant{int32_t{17}}, AllTypeVariant{int64_t{17}}, AllTypeVariant{17.0f}, AllTypeVariant{17.0},
+          AllTypeVariant{std::string{"17"}}};
+}
+
+// converts variants holding values of all data types to T, including the conversion from and to strings
+template <typename T>
+void BM_TypeCast(benchmark::State& state) {
+  const auto variants = variants_of_all_data_types();
+  for (auto _ : state) {
+    for (const auto& variant : variants) benchmark::DoNotOptimize(type_cast<T>(variant));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(variants.size()));
+}
+
+// converts variants that already hold a T, which is the common case when comparing values of a column
+template <typename T>
+void BM_TypeCastSameType(benchmark::State& state) {
+  const auto variant = AllTypeVariant{benchmark_value<T>(17)};
+  for (auto _ : state) benchmark::DoNotOptimize(type_cast<T>(variant));
+  state.SetItemsProcessed(state.iterations());
+}
+
+// resolves every data type, as operators do for each column they process
+void BM_ResolveDataType(benchmark::State& state) {
+  const auto data_types =
+      std::vector<DataType>{DataType::Int, DataType::Long, DataType::Float, DataType::Double, DataType::String};
+  for (auto _ : state) {
+    for (const auto data_type : data_types) {
+      resolve_data_type(data_type, [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        benchmark::DoNotOptimize(sizeof(ColumnDataType));
+      });
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(data_types.size()));
+}
+
+// resolves the type name of every data type, which is parsed into a DataType first, the last one being the most
+// expensive one to look up
+void BM_ResolveDataTypeName(benchmark::State& state) {
+  const auto type_names = std::vector<std::string>{"int", "long", "float", "double", "string"};
+  for (auto _ : state) {
+    for (const auto& type_name : type_names) {
+      resolve_data_type(type_name, [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        benchmark::DoNotOptimize(sizeof(ColumnDataType));
+      });
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(type_names.size()));
+}
+
+template <typename T>
+void BM_ResolveDataTypeOf(benchmark::State& state) {
+  const auto data_type = data_type_from_string(data_type_name<T>());
+  for (auto _ : state) {
+    resolve_data_type(data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      benchmark::DoNotOptimize(sizeof(ColumnDataType));
+    });
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_TypeCast, int32_t);
+BENCHMARK_TEMPLATE(BM_TypeCast, int64_t);
+BENCHMARK_TEMPLATE(BM_TypeCast, float);
+BENCHMARK_TEMPLATE(BM_TypeCast, double);
+BENCHMARK_TEMPLATE(BM_TypeCast, std::string);
+
+BENCHMARK_TEMPLATE(BM_TypeCastSameType, int32_t);
+BENCHMARK_TEMPLATE(BM_TypeCastSameType, int64_t);
+BENCHMARK_TEMPLATE(BM_TypeCastSameType, float);
+BENCHMARK_TEMPLATE(BM_TypeCastSameType, double);
+BENCHMARK_TEMPLATE(BM_TypeCastSameType, std::string);
+
+BENCHMARK(BM_ResolveDataType);
+BENCHMARK(BM_ResolveDataTypeName);
+BENCHMARK_TEMPLATE(BM_ResolveDataTypeOf, int32_t);
+BENCHMARK_TEMPLATE(BM_ResolveDataTypeOf, std::string);
+
+}  // namespace opossum
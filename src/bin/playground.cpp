@@ -1,11 +1,15 @@
 #include <iostream>
 
 #include "../lib/utils/assert.hpp"
+#include "scheduler/task_scheduler.hpp"
 #include "types.hpp"
 
 using namespace opossum;  // NOLINT
 
 int main() {
+  // without started workers, operators and the compression of chunks run in the calling thread only
+  TaskScheduler::get().begin();
   Assert(true, "We can use opossum files here :)");
+  TaskScheduler::get().finish();
   return 0;
 }
@@ -0,0 +1,71 @@
+#include "all_type_variant.hpp"
+
+#include <algorithm>
+#include <array>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+#include <boost/hana/unpack.hpp>
+
+namespace opossum {
+
+namespace {
+
+// calls comparator with the values of both variants if they are of the same type, and returns false otherwise
+template <typename Comparator>
+bool compare_same_type(const AllTypeVariant& lhs, const AllTypeVariant& rhs, const Comparator& comparator) {
+  return lhs.visit([&](const auto& lhs_value) {
+    return rhs.visit([&](const auto& rhs_value) {
+      if constexpr (std::is_same_v<std::decay_t<decltype(lhs_value)>, std::decay_t<decltype(rhs_value)>>) {
+        return comparator(lhs_value, rhs_value);
+      } else {
+        return false;
+      }
+    });
+  });
+}
+
+// returns the names of the data types, indexed by DataType
+const auto& data_type_names() {
+  static const auto names = hana::unpack(detail::type_strings, [](const auto... type_strings) {
+    return std::array<std::string, sizeof...(type_strings)>{type_strings...};
+  });
+  return names;
+}
+
+}  // namespace
+
+DataType data_type_from_string(const std::string& type_string) {
+  const auto& names = data_type_names();
+  const auto iter = std::find(names.begin(), names.end(), type_string);
+  Assert(iter != names.end(), "Unknown data type \"" + type_string + "\".");
+  return static_cast<DataType>(std::distance(names.begin(), iter));
+}
+
+const std::string& data_type_to_string(const DataType data_type) {
+  return data_type_names().at(static_cast<size_t>(data_type));
+}
+
+std::ostream& operator<<(std::ostream& stream, const DataType data_type) {
+  return stream << data_type_to_string(data_type);
+}
+
+bool operator==(const AllTypeVariant& lhs, const AllTypeVariant& rhs) {
+  return compare_same_type(lhs, rhs,
+                           [](const auto& lhs_value, const auto& rhs_value) { return lhs_value == rhs_value; });
+}
+
+bool operator<(const AllTypeVariant& lhs, const AllTypeVariant& rhs) {
+  if (variant_is_null(lhs) || variant_is_null(rhs)) return false;
+  if (lhs.index() != rhs.index()) return lhs.index() < rhs.index();
+  return compare_same_type(lhs, rhs,
+                           [](const auto& lhs_value, const auto& rhs_value) { return lhs_value < rhs_value; });
+}
+
+std::ostream& operator<<(std::ostream& stream, const AllTypeVariant& value) {
+  value.visit([&](const auto& typed_value) { stream << typed_value; });
+  return stream;
+}
+
+}  // namespace opossum
@@ -1,24 +1,31 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
+#include <ostream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
-#include <boost/hana/ext/boost/mpl/vector.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/not_equal.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/prepend.hpp>
 #include <boost/hana/second.hpp>
+#include <boost/hana/size.hpp>
+#include <boost/hana/take_while.hpp>
 #include <boost/hana/transform.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/zip.hpp>
-#include <boost/mpl/push_front.hpp>
-#include <boost/variant.hpp>
 
 #include <boost/preprocessor/seq/enum.hpp>
 #include <boost/preprocessor/seq/for_each.hpp>
 #include <boost/preprocessor/seq/transform.hpp>
 
+#include "null_value.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -57,18 +64,217 @@ struct to_pair {
 // Converts the tuples into pairs
 static constexpr auto data_types = hana::transform(data_types_as_tuples, to_pair{});  // NOLINT
 
-// Converts tuple to mpl vector
-using TypesAsMplVector = decltype(hana::to<hana::ext::boost::mpl::vector_tag>(types));
-
-// Creates boost::variant from mpl vector
-using AllTypeVariant = typename boost::make_variant_over<detail::TypesAsMplVector>::type;
+// Returns the index of type T in an Iterable
+template <typename Sequence, typename T>
+constexpr auto index_of(Sequence const& sequence, T const& element) {
+  constexpr auto size = decltype(hana::size(hana::take_while(sequence, hana::not_equal.to(element)))){};
+  return decltype(size)::value;
+}
 
 }  // namespace detail
 
 static constexpr auto types = detail::types;
 static constexpr auto data_types = detail::data_types;
 
-using AllTypeVariant = detail::AllTypeVariant;
+// Holds all types of AllTypeVariant in the order of their indices, NullValue being the first one
+static constexpr auto types_including_null = hana::prepend(types, hana::type_c<NullValue>);
+
+// The data types of columns, in the order of types and type_strings. Tables store the type of a column as a DataType,
+// which resolve_data_type() dispatches on with a switch, so that its name is only parsed once.
+enum class DataType : uint8_t { Int, Long, Float, Double, String };
+
+static_assert(static_cast<size_t>(DataType::String) + 1 == decltype(hana::size(types))::value,
+              "DataType has to list all types of AllTypeVariant");
+
+// the hana::type of a DataType, i.e., the type at the same index in types
+template <DataType data_type>
+inline constexpr auto data_type_c = hana::at_c<static_cast<size_t>(data_type)>(types);
+
+static_assert(std::is_same_v<decltype(data_type_c<DataType::Int>)::type, int32_t> &&
+                  std::is_same_v<decltype(data_type_c<DataType::Long>)::type, int64_t> &&
+                  std::is_same_v<decltype(data_type_c<DataType::Float>)::type, float> &&
+                  std::is_same_v<decltype(data_type_c<DataType::Double>)::type, double> &&
+                  std::is_same_v<decltype(data_type_c<DataType::String>)::type, std::string>,
+              "The DataTypes have to be in the order of types");
+
+// returns the DataType of the given name in type_strings, e.g., DataType::Long for "long"
+DataType data_type_from_string(const std::string& type_string);
+
+// returns the name of the data type, e.g., "long" for DataType::Long
+const std::string& data_type_to_string(const DataType data_type);
+
+std::ostream& operator<<(std::ostream& stream, const DataType data_type);
+
+// AllTypeVariant holds a value of any of the data types, or NULL. It takes 16 bytes: Numbers and strings of up to
+// SHORT_STRING_CAPACITY characters are stored inline, longer strings in a std::string on the heap. A
+// default-constructed AllTypeVariant is NULL.
+//
+// As for boost::variant, which it replaces, values of different types are never equal and are ordered by the index
+// of their type. Comparisons with NULL follow NullValue, i.e., they are never true: NULL is neither equal, unequal,
+// smaller, nor greater than any value, including NULL. Thus, values that might be NULL cannot be sorted with them.
+class AllTypeVariant {
+ public:
+  static constexpr auto SHORT_STRING_CAPACITY = size_t{14};
+
+  AllTypeVariant() = default;
+  AllTypeVariant(const NullValue&) {}  // NOLINT(runtime/explicit)
+  AllTypeVariant(const int32_t value) { _store(value); }  // NOLINT(runtime/explicit)
+  AllTypeVariant(const int64_t value) { _store(value); }  // NOLINT(runtime/explicit)
+  AllTypeVariant(const float value) { _store(value); }    // NOLINT(runtime/explicit)
+  AllTypeVariant(const double value) { _store(value); }   // NOLINT(runtime/explicit)
+  AllTypeVariant(const std::string& value) { _store_string(value); }  // NOLINT(runtime/explicit)
+  AllTypeVariant(const char* value) { _store_string(value); }         // NOLINT(runtime/explicit)
+  explicit AllTypeVariant(const std::string_view value) { _store_string(value); }
+
+  AllTypeVariant(const AllTypeVariant& other) { _copy_from(other); }
+  AllTypeVariant(AllTypeVariant&& other) noexcept { _move_from(other); }
+
+  AllTypeVariant& operator=(const AllTypeVariant& other) {
+    if (this != &other) {
+      _destroy();
+      _copy_from(other);
+    }
+    return *this;
+  }
+
+  AllTypeVariant& operator=(AllTypeVariant&& other) noexcept {
+    if (this != &other) {
+      _destroy();
+      _move_from(other);
+    }
+    return *this;
+  }
+
+  ~AllTypeVariant() { _destroy(); }
+
+  // returns the index of the type of the value in types_including_null, i.e., 0 for NULL
+  size_t index() const { return _type_index; }
+
+  // Returns the value, which has to be of type T. Strings are copied, which only allocates for long strings.
+  template <typename T>
+  T value() const {
+    DebugAssert(_type_index == _index_of<T>(), "AllTypeVariant does not hold a value of the requested type.");
+    if constexpr (std::is_same_v<T, std::string>) {
+      return std::string{_string_view()};
+    } else {
+      return _load<T>();
+    }
+  }
+
+  // Calls functor with the value, or with NullValue{} for NULL. Strings are passed as std::string_view, so that they
+  // are not copied.
+  template <typename Functor>
+  decltype(auto) visit(Functor&& functor) const {
+    switch (_type_index) {
+      case _index_of<int32_t>():
+        return functor(_load<int32_t>());
+      case _index_of<int64_t>():
+        return functor(_load<int64_t>());
+      case _index_of<float>():
+        return functor(_load<float>());
+      case _index_of<double>():
+        return functor(_load<double>());
+      case _index_of<std::string>():
+        return functor(_string_view());
+      default:
+        return functor(NullValue{});
+    }
+  }
+
+ private:
+  // marks _short_string_size of strings that are stored on the heap
+  static constexpr auto LONG_STRING = uint8_t{255};
+
+  template <typename T>
+  static constexpr uint8_t _index_of() {
+    return static_cast<uint8_t>(detail::index_of(types_including_null, hana::type_c<T>));
+  }
+
+  template <typename T>
+  T _load() const {
+    auto value = T{};
+    std::memcpy(&value, _data, sizeof(T));
+    return value;
+  }
+
+  template <typename T>
+  void _store(const T value) {
+    std::memcpy(_data, &value, sizeof(T));
+    _type_index = _index_of<T>();
+  }
+
+  void _store_string(const std::string_view value) {
+    _type_index = _index_of<std::string>();
+    if (value.size() <= SHORT_STRING_CAPACITY) {
+      std::memcpy(_data, value.data(), value.size());
+      _short_string_size = static_cast<uint8_t>(value.size());
+      return;
+    }
+    const auto* const long_string = new std::string{value};
+    std::memcpy(_data, &long_string, sizeof(long_string));
+    _short_string_size = LONG_STRING;
+  }
+
+  bool _is_long_string() const { return _short_string_size == LONG_STRING; }
+
+  const std::string* _long_string() const { return _load<const std::string*>(); }
+
+  std::string_view _string_view() const {
+    if (_is_long_string()) return *_long_string();
+    return std::string_view{_data, _short_string_size};
+  }
+
+  void _copy_from(const AllTypeVariant& other) {
+    if (other._is_long_string()) {
+      _store_string(*other._long_string());
+      return;
+    }
+    std::memcpy(_data, other._data, sizeof(_data));
+    _short_string_size = other._short_string_size;
+    _type_index = other._type_index;
+  }
+
+  // takes over the long string of other, which becomes NULL
+  void _move_from(AllTypeVariant& other) {
+    std::memcpy(_data, other._data, sizeof(_data));
+    _short_string_size = other._short_string_size;
+    _type_index = other._type_index;
+    other._short_string_size = 0;
+    other._type_index = 0;
+  }
+
+  void _destroy() {
+    if (_is_long_string()) delete _long_string();
+  }
+
+  // the value, the characters of a short string, or the pointer to a long string
+  alignas(8) char _data[SHORT_STRING_CAPACITY]{};
+  uint8_t _short_string_size{0};
+  uint8_t _type_index{0};
+};
+
+static_assert(sizeof(AllTypeVariant) == 16);
+
+std::ostream& operator<<(std::ostream& stream, const AllTypeVariant& value);
+
+// the AllTypeVariant that represents NULL
+static const auto NULL_VALUE = AllTypeVariant{};
+
+// returns whether the variant holds NULL
+inline bool variant_is_null(const AllTypeVariant& value) { return value.index() == 0; }
+
+bool operator==(const AllTypeVariant& lhs, const AllTypeVariant& rhs);
+bool operator<(const AllTypeVariant& lhs, const AllTypeVariant& rhs);
+
+// The other comparisons cannot simply negate == and <, which are false for NULL as well.
+inline bool operator!=(const AllTypeVariant& lhs, const AllTypeVariant& rhs) {
+  return !variant_is_null(lhs) && !variant_is_null(rhs) && !(lhs == rhs);
+}
+inline bool operator>(const AllTypeVariant& lhs, const AllTypeVariant& rhs) { return rhs < lhs; }
+inline bool operator<=(const AllTypeVariant& lhs, const AllTypeVariant& rhs) {
+  return !variant_is_null(lhs) && !variant_is_null(rhs) && !(rhs < lhs);
+}
+inline bool operator>=(const AllTypeVariant& lhs, const AllTypeVariant& rhs) { return rhs <= lhs; }
 
 /**
  * @defgroup Macros for explicitly instantiating template classes
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <ostream>
+
+namespace opossum {
+
+// NullValue is the type of NULL_VALUE, the AllTypeVariant that represents SQL's NULL.
+struct NullValue {};
+
+// As in SQL, comparisons with NULL are never true. In particular, NULL is not equal to NULL, use variant_is_null()
+// instead.
+inline bool operator==(const NullValue&, const NullValue&) { return false; }
+inline bool operator!=(const NullValue&, const NullValue&) { return false; }
+inline bool operator<(const NullValue&, const NullValue&) { return false; }
+inline bool operator<=(const NullValue&, const NullValue&) { return false; }
+inline bool operator>(const NullValue&, const NullValue&) { return false; }
+inline bool operator>=(const NullValue&, const NullValue&) { return false; }
+
+inline std::ostream& operator<<(std::ostream& stream, const NullValue&) { return stream << "NULL"; }
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// AbstractOperator is the abstract super class for all operators.
+// All operators have up to two input tables and one output table.
+// Their lifecycle is to be constructed, to be executed, and to have their output retrieved afterwards.
+class AbstractOperator : private Noncopyable {
+ public:
+  AbstractOperator(const std::shared_ptr<const AbstractOperator> left = nullptr,
+                   const std::shared_ptr<const AbstractOperator> right = nullptr);
+
+  virtual ~AbstractOperator() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  AbstractOperator(AbstractOperator&&) = default;
+  AbstractOperator& operator=(AbstractOperator&&) = default;
+
+  // executes the operator and stores its result, which can then be retrieved using get_output()
+  void execute();
+
+  // returns the result of the operator, execute() needs to be called before
+  std::shared_ptr<const Table> get_output() const;
+
+ protected:
+  // abstract method to be implemented by the concrete operator
+  virtual std::shared_ptr<const Table> _on_execute() = 0;
+
+  // returns the output of the left / right input operator
+  std::shared_ptr<const Table> _left_input_table() const;
+  std::shared_ptr<const Table> _right_input_table() const;
+
+  // Shared pointers to the input operators, can be nullptr.
+  std::shared_ptr<const AbstractOperator> _left_input;
+  std::shared_ptr<const AbstractOperator> _right_input;
+
+  // Is nullptr until the operator is executed
+  std::shared_ptr<const Table> _output;
+};
+
+}  // namespace opossum
@@ -0,0 +1,585 @@
+#include "aggregate.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "resolve_type.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The values of the group-by columns of a group
+using GroupKey = std::vector<AllTypeVariant>;
+
+// Index of a group in the groups of a chunk or of the whole input
+using GroupIndex = uint32_t;
+
+constexpr auto NO_GROUP = std::numeric_limits<GroupIndex>::max();
+
+// Chunks are only grouped by ValueID if their dictionary has at most this many entries per row. Larger dictionaries,
+// such as GlobalDictionaries shared by many chunks, would make filling the array indexed by ValueID more expensive
+// than hashing the rows.
+constexpr auto MAX_DICTIONARY_ENTRIES_PER_ROW = size_t{2};
+
+// Unlike the comparison operators of AllTypeVariant, GroupKeyHash and GroupKeyEqual treat NULLs as equal, as all NULLs
+// of a group-by column form a single group.
+struct GroupKeyHash {
+  size_t operator()(const GroupKey& key) const {
+    auto hash = size_t{0};
+    for (const auto& value : key) {
+      boost::hash_combine(hash, value.visit([](const auto& typed_value) -> size_t {
+        using ValueType = std::decay_t<decltype(typed_value)>;
+        if constexpr (std::is_same_v<ValueType, NullValue>) {
+          return 0;
+        } else {
+          return std::hash<ValueType>{}(typed_value);
+        }
+      }));
+    }
+    return hash;
+  }
+};
+
+struct GroupKeyEqual {
+  bool operator()(const GroupKey& lhs, const GroupKey& rhs) const {
+    for (auto index = size_t{0}; index < lhs.size(); ++index) {
+      if (variant_is_null(lhs[index]) || variant_is_null(rhs[index])) {
+        if (variant_is_null(lhs[index]) != variant_is_null(rhs[index])) return false;
+      } else if (!(lhs[index] == rhs[index])) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+using GroupIndexByKey = std::unordered_map<GroupKey, GroupIndex, GroupKeyHash, GroupKeyEqual>;
+
+// Computes one aggregate for a number of groups
+class BaseAggregateAccumulator {
+ public:
+  virtual ~BaseAggregateAccumulator() = default;
+
+  // sets the number of groups, new groups are empty
+  virtual void resize(const size_t group_count) = 0;
+
+  // adds the non-NULL values of the segment to their groups, group_indices holds the group of every position
+  virtual void accumulate(const BaseSegment& segment, const std::vector<GroupIndex>& group_indices) = 0;
+
+  // adds the groups of another accumulator of the same type, group_mapping holds the index of its groups in this one
+  virtual void merge(const BaseAggregateAccumulator& other, const std::vector<GroupIndex>& group_mapping) = 0;
+
+  virtual AllTypeVariant result(const GroupIndex group) const = 0;
+};
+
+template <typename T>
+class AggregateAccumulator : public BaseAggregateAccumulator {
+ public:
+  // sums of integers are computed as int64_t, all others as double. Strings cannot be summed.
+  using SumType = std::conditional_t<std::is_integral_v<T>, int64_t, double>;
+
+  explicit AggregateAccumulator(const AggregateFunction function) : _function{function} {}
+
+  void resize(const size_t group_count) final {
+    _counts.resize(group_count);
+    if (_function == AggregateFunction::Sum || _function == AggregateFunction::Avg) _sums.resize(group_count);
+    if (_function == AggregateFunction::Min || _function == AggregateFunction::Max) _extrema.resize(group_count);
+  }
+
+  void accumulate(const BaseSegment& segment, const std::vector<GroupIndex>& group_indices) final {
+    segment_iterate<T>(segment, [&](const auto& position) {
+      if (position.is_null()) return;
+      _add(group_indices[position.chunk_offset()], 1, position.value(), position.value());
+    });
+  }
+
+  void merge(const BaseAggregateAccumulator& other, const std::vector<GroupIndex>& group_mapping) final {
+    const auto& typed_other = static_cast<const AggregateAccumulator<T>&>(other);
+    for (auto other_group = GroupIndex{0}; other_group < group_mapping.size(); ++other_group) {
+      const auto count = typed_other._counts[other_group];
+      if (count == 0) continue;
+
+      const auto sum = typed_other._sums.empty() ? SumType{} : typed_other._sums[other_group];
+      const auto& extremum = typed_other._extrema.empty() ? T{} : typed_other._extrema[other_group];
+      _add(group_mapping[other_group], count, sum, extremum);
+    }
+  }
+
+  AllTypeVariant result(const GroupIndex group) const final {
+    const auto count = _counts[group];
+    if (_function == AggregateFunction::Count) return static_cast<int64_t>(count);
+    if (count == 0) return NULL_VALUE;
+
+    switch (_function) {
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        return _extrema[group];
+      case AggregateFunction::Sum:
+        return _sums[group];
+      case AggregateFunction::Avg:
+        return static_cast<double>(_sums[group]) / static_cast<double>(count);
+      case AggregateFunction::Count:
+        break;
+    }
+    Fail("Unsupported AggregateFunction.");
+  }
+
+ protected:
+  // adds count values with the given sum and minimum or maximum to a group
+  template <typename Value>
+  void _add(const GroupIndex group, const uint64_t count, const Value& sum, const T& extremum) {
+    const auto is_first = _counts[group] == 0;
+    _counts[group] += count;
+    switch (_function) {
+      case AggregateFunction::Min:
+        if (is_first || extremum < _extrema[group]) _extrema[group] = extremum;
+        break;
+      case AggregateFunction::Max:
+        if (is_first || _extrema[group] < extremum) _extrema[group] = extremum;
+        break;
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+        if constexpr (!std::is_same_v<T, std::string>) _sums[group] += sum;
+        break;
+      case AggregateFunction::Count:
+        break;
+    }
+  }
+
+  const AggregateFunction _function;
+  std::vector<uint64_t> _counts;
+  std::vector<SumType> _sums;
+  std::vector<T> _extrema;
+};
+
+std::unique_ptr<BaseAggregateAccumulator> make_accumulator(const DataType type, const AggregateFunction function) {
+  auto accumulator = std::unique_ptr<BaseAggregateAccumulator>{};
+  resolve_data_type(type, [&](auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    accumulator = std::make_unique<AggregateAccumulator<ColumnDataType>>(function);
+  });
+  return accumulator;
+}
+
+// returns the type of the output column of an aggregate
+DataType aggregate_type(const DataType type, const AggregateFunction function) {
+  switch (function) {
+    case AggregateFunction::Min:
+    case AggregateFunction::Max:
+      return type;
+    case AggregateFunction::Sum:
+      Assert(type != DataType::String, "Cannot compute the SUM of a string column.");
+      return type == DataType::Int || type == DataType::Long ? DataType::Long : DataType::Double;
+    case AggregateFunction::Avg:
+      Assert(type != DataType::String, "Cannot compute the AVG of a string column.");
+      return DataType::Double;
+    case AggregateFunction::Count:
+      return DataType::Long;
+  }
+  Fail("Unsupported AggregateFunction.");
+}
+
+std::string aggregate_name(const std::string& column_name, const AggregateFunction function) {
+  switch (function) {
+    case AggregateFunction::Min:
+      return "MIN(" + column_name + ")";
+    case AggregateFunction::Max:
+      return "MAX(" + column_name + ")";
+    case AggregateFunction::Sum:
+      return "SUM(" + column_name + ")";
+    case AggregateFunction::Avg:
+      return "AVG(" + column_name + ")";
+    case AggregateFunction::Count:
+      return "COUNT(" + column_name + ")";
+  }
+  Fail("Unsupported AggregateFunction.");
+}
+
+// The groups of a single chunk and their aggregates
+struct ChunkAggregate {
+  std::vector<GroupKey> group_keys;
+  std::vector<std::unique_ptr<BaseAggregateAccumulator>> accumulators;
+};
+
+// Assigns the rows of a chunk to groups by the values of a single dictionary-encoded group-by column. The group of a
+// ValueID is looked up in an array indexed by ValueID. Returns false if the segment is not dictionary encoded or its
+// dictionary is too large for the array to pay off (see MAX_DICTIONARY_ENTRIES_PER_ROW).
+template <typename T>
+bool group_by_value_ids(const BaseSegment& segment, std::vector<GroupIndex>& group_indices,
+                        std::vector<GroupKey>& group_keys) {
+  const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment);
+  if (!dictionary_segment) return false;
+
+  const auto& dictionary = *dictionary_segment->dictionary();
+  const auto size = dictionary_segment->size();
+  if (dictionary.size() > size_t{size} * MAX_DICTIONARY_ENTRIES_PER_ROW) return false;
+
+  const auto& attribute_vector = *dictionary_segment->attribute_vector();
+  const auto null_value_id = dictionary_segment->null_value_id();
+
+  // the NULL ValueID follows the last entry of the dictionary
+  auto group_by_value_id = std::vector<GroupIndex>(dictionary.size() + 1, NO_GROUP);
+  auto value_ids = std::array<ValueID, SEGMENT_ITERATE_BLOCK_SIZE>{};
+  for (auto block_begin = ChunkOffset{0}; block_begin < size; block_begin += SEGMENT_ITERATE_BLOCK_SIZE) {
+    const auto block_end = static_cast<ChunkOffset>(std::min(size_t{size}, block_begin + SEGMENT_ITERATE_BLOCK_SIZE));
+    attribute_vector.decode(block_begin, block_end, value_ids.data());
+    for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+      const auto value_id = value_ids[chunk_offset - block_begin];
+      auto& group = group_by_value_id[value_id];
+      if (group == NO_GROUP) {
+        group = static_cast<GroupIndex>(group_keys.size());
+        const auto value = value_id == null_value_id ? NULL_VALUE : AllTypeVariant{dictionary[value_id]};
+        group_keys.emplace_back(GroupKey{value});
+      }
+      group_indices[chunk_offset] = group;
+    }
+  }
+  return true;
+}
+
+// Chunks with fixed-width group keys are grouped by sorting their keys instead of hashing them if they have fewer than
+// this many rows per group on average. Then, most rows start a new group, and a hash table would allocate a node for
+// almost every row.
+constexpr auto MIN_ROWS_PER_GROUP_FOR_HASHING = size_t{4};
+
+// Group keys without strings of up to this many columns are packed into a PackedGroupKey
+constexpr auto MAX_PACKED_GROUP_BY_COLUMNS = size_t{4};
+
+// A fixed-width group key: the bits of the value of every group-by column in one word each, followed by a word with
+// one bit per group-by column that is set if its value is NULL. The words of NULLs and unused columns are zero.
+using PackedGroupKey = std::array<uint64_t, MAX_PACKED_GROUP_BY_COLUMNS + 1>;
+
+struct PackedGroupKeyHash {
+  size_t operator()(const PackedGroupKey& key) const { return boost::hash_range(key.begin(), key.end()); }
+};
+
+template <typename T>
+uint64_t pack_group_by_value(const T value) {
+  if constexpr (std::is_integral_v<T>) {
+    return static_cast<uint64_t>(value);
+  } else {
+    // 0.0 and -0.0 are equal and thus belong to the same group
+    const auto normalized_value = value == T{0} ? T{0} : value;
+    if constexpr (sizeof(T) == sizeof(uint32_t)) {
+      return std::bit_cast<uint32_t>(normalized_value);
+    } else {
+      return std::bit_cast<uint64_t>(normalized_value);
+    }
+  }
+}
+
+template <typename T>
+T unpack_group_by_value(const uint64_t word) {
+  if constexpr (std::is_integral_v<T>) {
+    return static_cast<T>(word);
+  } else if constexpr (sizeof(T) == sizeof(uint32_t)) {
+    return std::bit_cast<T>(static_cast<uint32_t>(word));
+  } else {
+    return std::bit_cast<T>(word);
+  }
+}
+
+bool group_keys_can_be_packed(const std::vector<DataType>& types) {
+  return types.size() <= MAX_PACKED_GROUP_BY_COLUMNS &&
+         std::none_of(types.begin(), types.end(), [](const auto type) { return type == DataType::String; });
+}
+
+// Returns the packed group keys of all rows of a chunk, which are filled column by column
+std::vector<PackedGroupKey> pack_group_keys(const Chunk& chunk, const std::vector<ColumnID>& column_ids,
+                                            const std::vector<DataType>& types) {
+  auto keys = std::vector<PackedGroupKey>(chunk.size());
+  for (auto index = size_t{0}; index < column_ids.size(); ++index) {
+    resolve_data_type(types[index], [&](auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        Fail("Strings cannot be packed into a group key.");
+      } else {
+        segment_iterate<ColumnDataType>(*chunk.get_segment(column_ids[index]), [&](const auto& position) {
+          auto& key = keys[position.chunk_offset()];
+          if (position.is_null()) {
+            key.back() |= uint64_t{1} << index;
+          } else {
+            key[index] = pack_group_by_value(position.value());
+          }
+        });
+      }
+    });
+  }
+  return keys;
+}
+
+GroupKey unpack_group_key(const PackedGroupKey& packed_key, const std::vector<DataType>& types) {
+  auto key = GroupKey(types.size());
+  for (auto index = size_t{0}; index < types.size(); ++index) {
+    if (packed_key.back() & (uint64_t{1} << index)) continue;
+
+    resolve_data_type(types[index], [&](auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      if constexpr (!std::is_same_v<ColumnDataType, std::string>) {
+        key[index] = unpack_group_by_value<ColumnDataType>(packed_key[index]);
+      }
+    });
+  }
+  return key;
+}
+
+// Returns a lower bound for the number of groups of a chunk, which has at least as many groups as any of its group-by
+// columns has distinct values. Returns 0 if the statistics of the chunk are not computed.
+size_t min_group_count(const Chunk& chunk, const std::vector<ColumnID>& column_ids) {
+  const auto statistics = chunk.statistics();
+  if (!statistics) return 0;
+
+  auto group_count = size_t{0};
+  for (const auto column_id : column_ids) {
+    const auto& segment_statistics = (*statistics)[column_id];
+    group_count = std::max(group_count, segment_statistics.distinct_count + (segment_statistics.null_count > 0));
+  }
+  return group_count;
+}
+
+// Assigns the rows of a chunk to groups by sorting their packed group keys, so that every run of equal keys forms a
+// group
+void group_by_sorted_keys(const std::vector<PackedGroupKey>& keys, const std::vector<DataType>& types,
+                          std::vector<GroupIndex>& group_indices, std::vector<GroupKey>& group_keys) {
+  auto sorted_rows = std::vector<std::pair<PackedGroupKey, ChunkOffset>>{};
+  sorted_rows.reserve(keys.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < keys.size(); ++chunk_offset) {
+    sorted_rows.emplace_back(keys[chunk_offset], chunk_offset);
+  }
+  std::sort(sorted_rows.begin(), sorted_rows.end());
+
+  for (auto index = size_t{0}; index < sorted_rows.size(); ++index) {
+    const auto& [key, chunk_offset] = sorted_rows[index];
+    if (index == 0 || key != sorted_rows[index - 1].first) group_keys.emplace_back(unpack_group_key(key, types));
+    group_indices[chunk_offset] = static_cast<GroupIndex>(group_keys.size() - 1);
+  }
+}
+
+// Assigns the rows of a chunk to groups by hashing their packed group keys
+void group_by_hashed_keys(const std::vector<PackedGroupKey>& keys, const std::vector<DataType>& types,
+                          std::vector<GroupIndex>& group_indices, std::vector<GroupKey>& group_keys) {
+  auto group_index_by_key = std::unordered_map<PackedGroupKey, GroupIndex, PackedGroupKeyHash>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < keys.size(); ++chunk_offset) {
+    const auto& key = keys[chunk_offset];
+    const auto [group, inserted] = group_index_by_key.try_emplace(key, static_cast<GroupIndex>(group_keys.size()));
+    if (inserted) group_keys.emplace_back(unpack_group_key(key, types));
+    group_indices[chunk_offset] = group->second;
+  }
+}
+
+// Assigns the rows of a chunk to groups by the values of a single group-by column, which are hashed as they are
+template <typename T>
+void group_by_single_column(const BaseSegment& segment, std::vector<GroupIndex>& group_indices,
+                            std::vector<GroupKey>& group_keys) {
+  auto group_index_by_value = std::unordered_map<T, GroupIndex>{};
+  auto null_group = NO_GROUP;
+  segment_iterate<T>(segment, [&](const auto& position) {
+    const auto next_group = static_cast<GroupIndex>(group_keys.size());
+    if (position.is_null()) {
+      if (null_group == NO_GROUP) {
+        null_group = next_group;
+        group_keys.emplace_back(GroupKey{NULL_VALUE});
+      }
+      group_indices[position.chunk_offset()] = null_group;
+      return;
+    }
+
+    const auto [group, inserted] = group_index_by_value.try_emplace(position.value(), next_group);
+    if (inserted) group_keys.emplace_back(GroupKey{AllTypeVariant{position.value()}});
+    group_indices[position.chunk_offset()] = group->second;
+  });
+}
+
+// Assigns the rows of a chunk to groups by GroupKeys. This is only used for several group-by columns that include a
+// string column or that are too many to be packed. The values of the group-by columns are materialized column by column
+// and then hashed row by row.
+void group_by_variant_keys(const Chunk& chunk, const std::vector<ColumnID>& column_ids,
+                           const std::vector<DataType>& types, std::vector<GroupIndex>& group_indices,
+                           std::vector<GroupKey>& group_keys) {
+  const auto row_count = chunk.size();
+  const auto group_by_column_count = column_ids.size();
+  auto group_by_values = std::vector<std::vector<AllTypeVariant>>(group_by_column_count);
+  for (auto index = size_t{0}; index < group_by_column_count; ++index) {
+    auto& values = group_by_values[index];
+    values.resize(row_count);
+    resolve_data_type(types[index], [&](auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      segment_iterate<ColumnDataType>(*chunk.get_segment(column_ids[index]), [&](const auto& position) {
+        if (!position.is_null()) values[position.chunk_offset()] = position.value();
+      });
+    });
+  }
+
+  auto group_index_by_key = GroupIndexByKey{};
+  auto key = GroupKey(group_by_column_count);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    for (auto index = size_t{0}; index < group_by_column_count; ++index) {
+      key[index] = group_by_values[index][chunk_offset];
+    }
+    const auto [group, inserted] = group_index_by_key.try_emplace(key, static_cast<GroupIndex>(group_keys.size()));
+    if (inserted) group_keys.emplace_back(key);
+    group_indices[chunk_offset] = group->second;
+  }
+}
+
+// Assigns the rows of a chunk to groups by the values of at least one group-by column, picking the cheapest of the
+// strategies above that applies
+void group_chunk(const Chunk& chunk, const std::vector<ColumnID>& column_ids, const std::vector<DataType>& types,
+                 std::vector<GroupIndex>& group_indices, std::vector<GroupKey>& group_keys) {
+  if (column_ids.size() == 1) {
+    auto grouped_by_value_ids = false;
+    resolve_data_type(types.front(), [&](auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      grouped_by_value_ids =
+          group_by_value_ids<ColumnDataType>(*chunk.get_segment(column_ids.front()), group_indices, group_keys);
+    });
+    if (grouped_by_value_ids) return;
+  }
+
+  const auto packed = group_keys_can_be_packed(types);
+  if (packed && min_group_count(chunk, column_ids) * MIN_ROWS_PER_GROUP_FOR_HASHING >= chunk.size()) {
+    group_by_sorted_keys(pack_group_keys(chunk, column_ids, types), types, group_indices, group_keys);
+  } else if (column_ids.size() == 1) {
+    resolve_data_type(types.front(), [&](auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      group_by_single_column<ColumnDataType>(*chunk.get_segment(column_ids.front()), group_indices, group_keys);
+    });
+  } else if (packed) {
+    group_by_hashed_keys(pack_group_keys(chunk, column_ids, types), types, group_indices, group_keys);
+  } else {
+    group_by_variant_keys(chunk, column_ids, types, group_indices, group_keys);
+  }
+}
+
+}  // namespace
+
+Aggregate::Aggregate(const std::shared_ptr<const AbstractOperator>& in,
+                     const std::vector<AggregateDefinition>& aggregates,
+                     const std::vector<ColumnID>& group_by_column_ids)
+    : AbstractOperator(in), _aggregates(aggregates), _group_by_column_ids(group_by_column_ids) {}
+
+const std::vector<AggregateDefinition>& Aggregate::aggregates() const { return _aggregates; }
+
+const std::vector<ColumnID>& Aggregate::group_by_column_ids() const { return _group_by_column_ids; }
+
+std::shared_ptr<const Table> Aggregate::_on_execute() {
+  const auto input_table = _left_input_table();
+
+  auto output_table = std::make_shared<Table>(input_table->target_chunk_size());
+  for (const auto column_id : _group_by_column_ids) {
+    output_table->add_column(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  for (const auto& aggregate : _aggregates) {
+    const auto type = input_table->column_type(aggregate.column_id);
+    output_table->add_column(aggregate_name(input_table->column_name(aggregate.column_id), aggregate.function),
+                             aggregate_type(type, aggregate.function));
+  }
+
+  auto group_by_types = std::vector<DataType>{};
+  for (const auto column_id : _group_by_column_ids) group_by_types.emplace_back(input_table->column_type(column_id));
+
+  const auto make_accumulators = [&] {
+    auto accumulators = std::vector<std::unique_ptr<BaseAggregateAccumulator>>{};
+    for (const auto& aggregate : _aggregates) {
+      accumulators.emplace_back(make_accumulator(input_table->column_type(aggregate.column_id), aggregate.function));
+    }
+    return accumulators;
+  };
+
+  // Every chunk is pre-aggregated by its own task.
+  const auto chunk_count = input_table->chunk_count();
+  auto chunk_aggregates = std::vector<ChunkAggregate>(chunk_count);
+  TaskScheduler::get().for_each_chunk(chunk_count, [&](const ChunkID chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    const auto row_count = chunk->size();
+    if (row_count == 0) return;
+
+    auto group_indices = std::vector<GroupIndex>(row_count);
+    auto& group_keys = chunk_aggregates[chunk_id].group_keys;
+    if (_group_by_column_ids.empty()) {
+      group_keys.emplace_back();
+    } else {
+      group_chunk(*chunk, _group_by_column_ids, group_by_types, group_indices, group_keys);
+    }
+
+    auto& accumulators = chunk_aggregates[chunk_id].accumulators;
+    accumulators = make_accumulators();
+    for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+      accumulators[aggregate_index]->resize(group_keys.size());
+      accumulators[aggregate_index]->accumulate(*chunk->get_segment(_aggregates[aggregate_index].column_id),
+                                                group_indices);
+    }
+  });
+
+  // The groups of all chunks are merged. Without group-by columns, there is exactly one group.
+  auto group_keys = std::vector<GroupKey>{};
+  auto group_index_by_key = GroupIndexByKey{};
+  if (_group_by_column_ids.empty()) {
+    group_keys.emplace_back();
+    group_index_by_key.emplace(GroupKey{}, GroupIndex{0});
+  }
+  auto accumulators = make_accumulators();
+  for (auto& chunk_aggregate : chunk_aggregates) {
+    if (chunk_aggregate.group_keys.empty()) continue;
+
+    auto group_mapping = std::vector<GroupIndex>{};
+    group_mapping.reserve(chunk_aggregate.group_keys.size());
+    for (auto& key : chunk_aggregate.group_keys) {
+      const auto [group, inserted] = group_index_by_key.try_emplace(key, static_cast<GroupIndex>(group_keys.size()));
+      if (inserted) group_keys.emplace_back(std::move(key));
+      group_mapping.emplace_back(group->second);
+    }
+
+    for (auto aggregate_index = size_t{0}; aggregate_index < accumulators.size(); ++aggregate_index) {
+      accumulators[aggregate_index]->resize(group_keys.size());
+      accumulators[aggregate_index]->merge(*chunk_aggregate.accumulators[aggregate_index], group_mapping);
+    }
+  }
+  for (auto& accumulator : accumulators) accumulator->resize(group_keys.size());
+
+  // The groups are written to chunks of ValueSegments of the target chunk size.
+  const auto target_chunk_size = output_table->target_chunk_size();
+  const auto output_column_count = output_table->column_count();
+  for (auto chunk_begin = size_t{0}; chunk_begin < group_keys.size(); chunk_begin += target_chunk_size) {
+    const auto chunk_end = std::min(group_keys.size(), chunk_begin + target_chunk_size);
+    auto output_chunk = std::make_unique<Chunk>();
+    for (auto column_id = ColumnID{0}; column_id < output_column_count; ++column_id) {
+      resolve_data_type(output_table->column_type(column_id), [&](auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        auto segment = std::make_shared<ValueSegment<ColumnDataType>>();
+        for (auto group = chunk_begin; group < chunk_end; ++group) {
+          if (column_id < _group_by_column_ids.size()) {
+            segment->append(group_keys[group][column_id]);
+          } else {
+            segment->append(accumulators[column_id - _group_by_column_ids.size()]->result(group));
+          }
+        }
+        output_chunk->add_segment(segment);
+      });
+    }
+    output_table->emplace_chunk(std::move(output_chunk));
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class AggregateFunction { Min, Max, Sum, Avg, Count };
+
+// An aggregate function applied to a column, e.g., SUM(column). NULLs are ignored.
+struct AggregateDefinition {
+  ColumnID column_id;
+  AggregateFunction function;
+};
+
+// Operator that groups the rows of its input by the values of the group-by columns (GROUP BY) and computes the given
+// aggregates per group. The output holds the group-by columns followed by one column per aggregate, e.g., "SUM(a)",
+// and consists of ValueSegments. The order of the groups is unspecified. NULLs in group-by columns form a group of
+// their own. Without group-by columns, the output consists of a single row, even for an empty input.
+//
+// Every chunk is pre-aggregated by its own task into a local table of groups, which are merged at the end. The rows of
+// a chunk are assigned to groups by the first of these strategies that applies:
+//  - a single dictionary-encoded group-by column: the groups are looked up in an array indexed by ValueID
+//  - up to four group-by columns without strings, if the statistics of the chunk show fewer than four rows per group:
+//    the rows are sorted by their group keys packed into fixed-width words, so that runs of equal keys form groups
+//  - a single group-by column: its values are hashed as they are, without AllTypeVariants
+//  - up to four group-by columns without strings: the packed group keys are hashed
+//  - otherwise, the group keys are hashed as vectors of AllTypeVariants
+//
+// COUNT returns a long, SUM of int or long columns returns a long, SUM of float or double columns and AVG return a
+// double, and MIN and MAX return the type of their column. SUM, AVG, MIN, and MAX of groups without any non-NULL value
+// are NULL.
+class Aggregate : public AbstractOperator {
+ public:
+  Aggregate(const std::shared_ptr<const AbstractOperator>& in, const std::vector<AggregateDefinition>& aggregates,
+            const std::vector<ColumnID>& group_by_column_ids);
+
+  const std::vector<AggregateDefinition>& aggregates() const;
+  const std::vector<ColumnID>& group_by_column_ids() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<AggregateDefinition> _aggregates;
+  const std::vector<ColumnID> _group_by_column_ids;
+};
+
+}  // namespace opossum
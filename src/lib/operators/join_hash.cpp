@@ -0,0 +1,419 @@
+#include "join_hash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Assumed size of the L2 cache, into which the hash table of a single partition should fit
+constexpr auto L2_CACHE_SIZE = size_t{256 * 1024};
+
+// Upper bound for the number of partitions, more partitions would make partitioning itself cache-unfriendly
+constexpr auto MAX_RADIX_BITS = size_t{12};
+
+// Marks the end of a chain of entries with the same value
+constexpr auto CHAIN_END = std::numeric_limits<size_t>::max();
+
+template <typename T>
+struct BuildEntry {
+  T value;
+  RowID row_id;
+};
+
+// Hash table on a column of a table. The entries are partitioned by the hash of their value, and every partition has
+// its own hash table that maps a value to the first entry with that value. Further entries with the same value are
+// chained via _next.
+template <typename T>
+class RadixHashTable {
+ public:
+  RadixHashTable(const Table& table, const ColumnID column_id) {
+    // The partitions hold the entries, their chain links, and the nodes of the hash tables.
+    const auto bytes_per_row = sizeof(BuildEntry<T>) + sizeof(size_t) + sizeof(std::pair<T, size_t>) + sizeof(void*);
+    const auto size = table.row_count() * bytes_per_row;
+    while (_radix_bits < MAX_RADIX_BITS && (size >> _radix_bits) > L2_CACHE_SIZE) ++_radix_bits;
+    const auto partition_count = size_t{1} << _radix_bits;
+
+    // The rows of every chunk are materialized and counted per partition in parallel.
+    const auto chunk_count = table.chunk_count();
+    auto entries_per_chunk = std::vector<std::vector<BuildEntry<T>>>(chunk_count);
+    auto partitions_per_chunk = std::vector<std::vector<uint32_t>>(chunk_count);
+    auto histograms = std::vector<std::vector<size_t>>(chunk_count, std::vector<size_t>(partition_count));
+    TaskScheduler::get().for_each_chunk(chunk_count, [&](const ChunkID chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      if (chunk->size() == 0) return;
+
+      auto& entries = entries_per_chunk[chunk_id];
+      auto& partitions = partitions_per_chunk[chunk_id];
+      entries.reserve(chunk->size());
+      partitions.reserve(chunk->size());
+      segment_iterate<T>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) return;
+        const auto partition = _partition(position.value());
+        entries.emplace_back(BuildEntry<T>{position.value(), RowID{chunk_id, position.chunk_offset()}});
+        partitions.emplace_back(static_cast<uint32_t>(partition));
+        ++histograms[chunk_id][partition];
+      });
+    });
+
+    // Every chunk writes its entries of a partition to its own range of that partition.
+    _partition_offsets.resize(partition_count + 1);
+    auto write_offsets = std::vector<std::vector<size_t>>(chunk_count, std::vector<size_t>(partition_count));
+    auto offset = size_t{0};
+    for (auto partition = size_t{0}; partition < partition_count; ++partition) {
+      _partition_offsets[partition] = offset;
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        write_offsets[chunk_id][partition] = offset;
+        offset += histograms[chunk_id][partition];
+      }
+    }
+    _partition_offsets[partition_count] = offset;
+
+    _entries.resize(offset);
+    TaskScheduler::get().for_each_chunk(chunk_count, [&](const ChunkID chunk_id) {
+      auto& entries = entries_per_chunk[chunk_id];
+      auto& offsets = write_offsets[chunk_id];
+      for (auto entry_index = size_t{0}; entry_index < entries.size(); ++entry_index) {
+        _entries[offsets[partitions_per_chunk[chunk_id][entry_index]]++] = std::move(entries[entry_index]);
+      }
+      entries = {};
+    });
+
+    // The hash tables of the partitions are built in parallel.
+    _heads.resize(partition_count);
+    _next.resize(_entries.size());
+    auto tasks = std::vector<std::shared_ptr<JobTask>>{};
+    tasks.reserve(partition_count);
+    for (auto partition = size_t{0}; partition < partition_count; ++partition) {
+      if (_partition_offsets[partition] == _partition_offsets[partition + 1]) continue;
+      tasks.emplace_back(std::make_shared<JobTask>([&, partition] {
+        auto& heads = _heads[partition];
+        heads.reserve(_partition_offsets[partition + 1] - _partition_offsets[partition]);
+        for (auto entry_index = _partition_offsets[partition]; entry_index < _partition_offsets[partition + 1];
+             ++entry_index) {
+          const auto [head, inserted] = heads.try_emplace(_entries[entry_index].value, entry_index);
+          _next[entry_index] = inserted ? CHAIN_END : head->second;
+          head->second = entry_index;
+        }
+      }));
+    }
+    TaskScheduler::get().schedule_and_wait_for_tasks(tasks);
+  }
+
+  // calls functor with the RowID of every entry with the given value
+  template <typename Functor>
+  void for_each_match(const T& value, const Functor& functor) const {
+    const auto& heads = _heads[_partition(value)];
+    const auto head = heads.find(value);
+    if (head == heads.cend()) return;
+
+    for (auto entry_index = head->second; entry_index != CHAIN_END; entry_index = _next[entry_index]) {
+      functor(_entries[entry_index].row_id);
+    }
+  }
+
+ protected:
+  // The partition is taken from the upper bits of the scrambled hash, so that it is independent of the bucket that
+  // std::unordered_map derives from the same hash.
+  size_t _partition(const T& value) const {
+    if (_radix_bits == 0) return 0;
+    return (std::hash<T>{}(value) * 0x9E3779B97F4A7C15ull) >> (64 - _radix_bits);
+  }
+
+  size_t _radix_bits = 0;
+
+  // the entries of partition p are stored in [_partition_offsets[p], _partition_offsets[p + 1])
+  std::vector<BuildEntry<T>> _entries;
+  std::vector<size_t> _partition_offsets;
+  std::vector<size_t> _next;
+  std::vector<std::unordered_map<T, size_t>> _heads;
+};
+
+// Calls functor with the ValueID and the offset of every non-NULL value of a DictionarySegment<T>
+template <typename T, typename Functor>
+void for_each_value_id(const BaseSegment& segment, const Functor& functor) {
+  const auto& dictionary_segment = static_cast<const DictionarySegment<T>&>(segment);
+  const auto& attribute_vector = *dictionary_segment.attribute_vector();
+  const auto null_value_id = dictionary_segment.null_value_id();
+  const auto size = dictionary_segment.size();
+
+  auto value_ids = std::array<ValueID, SEGMENT_ITERATE_BLOCK_SIZE>{};
+  for (auto block_begin = ChunkOffset{0}; block_begin < size; block_begin += SEGMENT_ITERATE_BLOCK_SIZE) {
+    const auto block_end = static_cast<ChunkOffset>(std::min(size_t{size}, block_begin + SEGMENT_ITERATE_BLOCK_SIZE));
+    attribute_vector.decode(block_begin, block_end, value_ids.data());
+    for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+      const auto value_id = value_ids[chunk_offset - block_begin];
+      if (value_id != null_value_id) functor(value_id, chunk_offset);
+    }
+  }
+}
+
+// Returns the dictionary shared by the segments of a column if all of them are DictionarySegments that use the same
+// dictionary, e.g., a GlobalDictionary. Returns nullptr otherwise.
+template <typename T>
+std::shared_ptr<const std::vector<T>> shared_dictionary(const Table& table, const ColumnID column_id) {
+  auto dictionary = std::shared_ptr<const std::vector<T>>{};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (chunk->size() == 0) continue;
+
+    const auto segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(chunk->get_segment(column_id));
+    if (!segment || (dictionary && segment->dictionary() != dictionary)) return nullptr;
+    dictionary = segment->dictionary();
+  }
+  return dictionary;
+}
+
+// Index of a column whose segments share one dictionary. As ValueIDs are dense, the rows are grouped by ValueID with a
+// counting sort instead of being hashed.
+template <typename T>
+class ValueIDIndex {
+ public:
+  ValueIDIndex(const Table& table, const ColumnID column_id, const size_t dictionary_size) {
+    // The ValueIDs of the chunks are decoded in parallel.
+    const auto chunk_count = table.chunk_count();
+    auto value_ids_per_chunk = std::vector<std::vector<std::pair<ValueID, ChunkOffset>>>(chunk_count);
+    TaskScheduler::get().for_each_chunk(chunk_count, [&](const ChunkID chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      if (chunk->size() == 0) return;
+
+      auto& value_ids = value_ids_per_chunk[chunk_id];
+      value_ids.reserve(chunk->size());
+      for_each_value_id<T>(*chunk->get_segment(column_id), [&](const ValueID value_id, const ChunkOffset chunk_offset) {
+        value_ids.emplace_back(value_id, chunk_offset);
+      });
+    });
+
+    _offsets.resize(dictionary_size + 1);
+    for (const auto& value_ids : value_ids_per_chunk) {
+      for (const auto& [value_id, chunk_offset] : value_ids) ++_offsets[value_id + 1];
+    }
+    for (auto value_id = size_t{0}; value_id < dictionary_size; ++value_id) {
+      _offsets[value_id + 1] += _offsets[value_id];
+    }
+
+    _row_ids.resize(_offsets.back());
+    auto write_offsets = std::vector<size_t>(_offsets.cbegin(), _offsets.cend() - 1);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      for (const auto& [value_id, chunk_offset] : value_ids_per_chunk[chunk_id]) {
+        _row_ids[write_offsets[value_id]++] = RowID{chunk_id, chunk_offset};
+      }
+    }
+  }
+
+  // calls functor with the RowID of every row with the given ValueID
+  template <typename Functor>
+  void for_each_match(const ValueID value_id, const Functor& functor) const {
+    for (auto index = _offsets[value_id]; index < _offsets[value_id + 1]; ++index) {
+      functor(_row_ids[index]);
+    }
+  }
+
+ protected:
+  // the rows with ValueID v are stored in [_offsets[v], _offsets[v + 1])
+  std::vector<size_t> _offsets;
+  std::vector<RowID> _row_ids;
+};
+
+// Describes how the output references a column of an input table. If the input consists of ReferenceSegments, the
+// output references the same column as the input does, and pos_lists holds the PosList of every input chunk, so that
+// positions can be resolved. Otherwise, the output references the input column and pos_lists is empty.
+struct ColumnReference {
+  std::shared_ptr<const Table> referenced_table;
+  ColumnID referenced_column_id;
+  std::vector<std::shared_ptr<const PosList>> pos_lists;
+  // the first column with the same pos_lists, which the output chunks share their resolved PosList with
+  ColumnID shared_pos_list_column_id;
+};
+
+// Collects the ColumnReference of every column of input_table. Every chunk is checked, as a table could mix chunks of
+// ReferenceSegments with other chunks, which cannot be referenced by a single ReferenceSegment. Empty chunks are
+// skipped, as no position refers to them.
+std::vector<ColumnReference> collect_column_references(const std::shared_ptr<const Table>& input_table) {
+  const auto chunk_count = input_table->chunk_count();
+  const auto column_count = input_table->column_count();
+  auto chunks = std::vector<std::shared_ptr<const Chunk>>{};
+  chunks.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunks.emplace_back(input_table->get_chunk(chunk_id));
+  }
+
+  auto column_references = std::vector<ColumnReference>{};
+  column_references.reserve(column_count);
+  auto first_column_ids = std::map<std::vector<std::shared_ptr<const PosList>>, ColumnID>{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    auto first_reference_segment = std::shared_ptr<const ReferenceSegment>{};
+    auto has_other_segments = false;
+    auto pos_lists = std::vector<std::shared_ptr<const PosList>>(chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      if (chunks[chunk_id]->size() == 0) continue;
+
+      const auto segment = chunks[chunk_id]->get_segment(column_id);
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+      if (!reference_segment) {
+        has_other_segments = true;
+        continue;
+      }
+      if (!first_reference_segment) first_reference_segment = reference_segment;
+      DebugAssert(reference_segment->referenced_table() == first_reference_segment->referenced_table() &&
+                      reference_segment->referenced_column_id() == first_reference_segment->referenced_column_id(),
+                  "All chunks of a column have to reference the same column.");
+      pos_lists[chunk_id] = reference_segment->pos_list();
+    }
+    Assert(!first_reference_segment || !has_other_segments,
+           "Either all or none of the chunks of a column have to consist of ReferenceSegments.");
+
+    if (!first_reference_segment) {
+      column_references.emplace_back(ColumnReference{input_table, column_id, {}, column_id});
+      continue;
+    }
+
+    // Columns whose ReferenceSegments share their PosLists in every chunk also share the resolved PosList.
+    const auto shared_pos_list_column_id = first_column_ids.try_emplace(pos_lists, column_id).first->second;
+    column_references.emplace_back(ColumnReference{first_reference_segment->referenced_table(),
+                                                   first_reference_segment->referenced_column_id(),
+                                                   std::move(pos_lists), shared_pos_list_column_id});
+  }
+  return column_references;
+}
+
+// Adds a ReferenceSegment for every column of an input table to output_chunk that holds the rows at the given
+// positions. If the input consists of ReferenceSegments, the positions are resolved, so that the output never
+// references another ReferenceSegment.
+void add_reference_segments(Chunk& output_chunk, const std::vector<ColumnReference>& column_references,
+                            const std::shared_ptr<const PosList>& pos_list) {
+  const auto column_count = column_references.size();
+  auto resolved_pos_lists = std::vector<std::shared_ptr<const PosList>>(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto& column_reference = column_references[column_id];
+    auto& resolved_pos_list = resolved_pos_lists[column_id];
+    if (column_reference.pos_lists.empty()) {
+      resolved_pos_list = pos_list;
+    } else if (column_reference.shared_pos_list_column_id != column_id) {
+      resolved_pos_list = resolved_pos_lists[column_reference.shared_pos_list_column_id];
+    } else {
+      auto resolved = std::make_shared<PosList>();
+      resolved->reserve(pos_list->size());
+      for (const auto& row_id : *pos_list) {
+        resolved->emplace_back((*column_reference.pos_lists[row_id.chunk_id])[row_id.chunk_offset]);
+      }
+      resolved_pos_list = std::move(resolved);
+    }
+    output_chunk.add_segment(std::make_shared<ReferenceSegment>(
+        column_reference.referenced_table, column_reference.referenced_column_id, resolved_pos_list));
+  }
+}
+
+}  // namespace
+
+JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
+                   const std::shared_ptr<const AbstractOperator>& right, const ColumnID left_column_id,
+                   const ColumnID right_column_id)
+    : AbstractOperator(left, right), _left_column_id(left_column_id), _right_column_id(right_column_id) {}
+
+ColumnID JoinHash::left_column_id() const { return _left_column_id; }
+
+ColumnID JoinHash::right_column_id() const { return _right_column_id; }
+
+std::shared_ptr<const Table> JoinHash::_on_execute() {
+  const auto left_table = _left_input_table();
+  const auto right_table = _right_input_table();
+  const auto column_type = left_table->column_type(_left_column_id);
+  Assert(column_type == right_table->column_type(_right_column_id), "JoinHash requires join columns of the same type.");
+
+  auto output_table = std::make_shared<Table>(left_table->target_chunk_size());
+  for (const auto& input_table : {left_table, right_table}) {
+    for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+      output_table->add_column(input_table->column_name(column_id), input_table->column_type(column_id));
+    }
+  }
+
+  // The hash table is built on the smaller input.
+  const auto build_left = left_table->row_count() <= right_table->row_count();
+  const auto& build_table = build_left ? left_table : right_table;
+  const auto& probe_table = build_left ? right_table : left_table;
+  const auto build_column_id = build_left ? _left_column_id : _right_column_id;
+  const auto probe_column_id = build_left ? _right_column_id : _left_column_id;
+
+  // The referenced columns of both inputs are collected once instead of for every output chunk.
+  const auto left_column_references = collect_column_references(left_table);
+  const auto right_column_references = collect_column_references(right_table);
+
+  resolve_data_type(column_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // Chunks of the probe side are probed in parallel. Each task only writes the matches of its own chunk.
+    // for_each_key calls a functor with the join key and the offset of every non-NULL row of a segment.
+    const auto chunk_count = probe_table->chunk_count();
+    auto build_matches_per_chunk = std::vector<std::shared_ptr<PosList>>(chunk_count);
+    auto probe_matches_per_chunk = std::vector<std::shared_ptr<PosList>>(chunk_count);
+    const auto probe = [&](const auto& index, const auto& for_each_key) {
+      TaskScheduler::get().for_each_chunk(chunk_count, [&](const ChunkID chunk_id) {
+        auto build_matches = std::make_shared<PosList>();
+        auto probe_matches = std::make_shared<PosList>();
+        const auto chunk = probe_table->get_chunk(chunk_id);
+        if (chunk->size() > 0) {
+          for_each_key(*chunk->get_segment(probe_column_id), [&](const auto& key, const ChunkOffset chunk_offset) {
+            index.for_each_match(key, [&](const RowID& build_row_id) {
+              build_matches->emplace_back(build_row_id);
+              probe_matches->emplace_back(RowID{chunk_id, chunk_offset});
+            });
+          });
+        }
+        build_matches_per_chunk[chunk_id] = std::move(build_matches);
+        probe_matches_per_chunk[chunk_id] = std::move(probe_matches);
+      });
+    };
+
+    // If both columns share a dictionary, equal values have equal ValueIDs, so the join compares ValueIDs and never
+    // decodes a value.
+    const auto dictionary = shared_dictionary<ColumnDataType>(*build_table, build_column_id);
+    if (dictionary && dictionary == shared_dictionary<ColumnDataType>(*probe_table, probe_column_id)) {
+      const auto index = ValueIDIndex<ColumnDataType>{*build_table, build_column_id, dictionary->size()};
+      probe(index, [](const BaseSegment& segment, const auto& functor) {
+        for_each_value_id<ColumnDataType>(segment, functor);
+      });
+    } else {
+      const auto hash_table = RadixHashTable<ColumnDataType>{*build_table, build_column_id};
+      probe(hash_table, [](const BaseSegment& segment, const auto& functor) {
+        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+          if (!position.is_null()) functor(position.value(), position.chunk_offset());
+        });
+      });
+    }
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      if (probe_matches_per_chunk[chunk_id]->empty()) continue;
+
+      const auto& left_matches = build_left ? build_matches_per_chunk[chunk_id] : probe_matches_per_chunk[chunk_id];
+      const auto& right_matches = build_left ? probe_matches_per_chunk[chunk_id] : build_matches_per_chunk[chunk_id];
+      auto output_chunk = std::make_unique<Chunk>();
+      add_reference_segments(*output_chunk, left_column_references, left_matches);
+      add_reference_segments(*output_chunk, right_column_references, right_matches);
+      output_table->emplace_chunk(std::move(output_chunk));
+    }
+  });
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Operator that returns all pairs of rows of its two inputs for which the values in the given columns are equal (inner
+// equi-join). NULLs do not match anything. The output holds the columns of the left input followed by those of the
+// right input. It consists of ReferenceSegments, one chunk per chunk of the probe side with matches.
+//
+// A hash table is built on the smaller input and probed with the chunks of the larger input in parallel. The build
+// side is radix-partitioned by the hash of the join key, so that the hash table of each partition fits into the L2
+// cache.
+class JoinHash : public AbstractOperator {
+ public:
+  JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
+           const ColumnID left_column_id, const ColumnID right_column_id);
+
+  ColumnID left_column_id() const;
+  ColumnID right_column_id() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _left_column_id;
+  const ColumnID _right_column_id;
+};
+
+}  // namespace opossum
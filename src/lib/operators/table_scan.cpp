@@ -0,0 +1,405 @@
+#include "table_scan.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <compare>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/segment_statistics.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "type_comparison.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Number of rows that are evaluated before their matches are appended to the PosList
+constexpr auto SCAN_BLOCK_SIZE = size_t{1024};
+
+// One byte per row of a block that is 1 if the row matches and 0 otherwise
+using BlockMask = std::array<uint8_t, SCAN_BLOCK_SIZE>;
+
+// Writes predicate(index in block) to the mask for all rows of a block. Nothing is carried from one row to the next,
+// so the compiler vectorizes this loop for predicates that only compare values.
+template <typename Predicate>
+void evaluate_block(const size_t block_size, const Predicate& predicate, BlockMask& mask) {
+  for (auto index = size_t{0}; index < block_size; ++index) {
+    mask[index] = static_cast<uint8_t>(predicate(index));
+  }
+}
+
+// Clears the mask entries of all NULL rows of a block, given the null bitmap words of the block. Each word covers a
+// fixed number of rows, so the compiler vectorizes the inner loop into a bitwise AND of the two masks.
+void mask_nulls(const uint64_t* null_words, const size_t block_size, BlockMask& mask) {
+  for (auto word_index = size_t{0}; word_index * 64 < block_size; ++word_index) {
+    const auto not_null_word = ~null_words[word_index];
+    for (auto bit_index = size_t{0}; bit_index < 64; ++bit_index) {
+      mask[word_index * 64 + bit_index] &= static_cast<uint8_t>((not_null_word >> bit_index) & 1);
+    }
+  }
+}
+
+// Appends the offsets of all rows in [block_begin, block_begin + block_size) whose mask entry is set. The offset is
+// written unconditionally and the write cursor only advances on a match, so there are no branch mispredictions on
+// unsorted data.
+void compact_block(const ChunkID chunk_id, const ChunkOffset block_begin, const size_t block_size,
+                   const BlockMask& mask, PosList& pos_list) {
+  auto matches = std::array<ChunkOffset, SCAN_BLOCK_SIZE>{};
+  auto match_count = size_t{0};
+  for (auto index = size_t{0}; index < block_size; ++index) {
+    matches[match_count] = static_cast<ChunkOffset>(block_begin + index);
+    match_count += mask[index];
+  }
+
+  for (auto match_index = size_t{0}; match_index < match_count; ++match_index) {
+    pos_list.emplace_back(RowID{chunk_id, matches[match_index]});
+  }
+}
+
+// Converts a numeric search value to the integral data type T of the scanned column. Numbers out of the range of T are
+// clamped to its bounds, others are truncated towards zero. Either way, no value of T lies strictly between the search
+// value and the converted one. Returns the converted value and how it compares to the search value.
+template <typename T, typename Source>
+std::pair<T, std::strong_ordering> convert_search_number(const Source source) {
+  if constexpr (std::is_integral_v<Source>) {
+    if (std::cmp_less(source, std::numeric_limits<T>::min())) {
+      return {std::numeric_limits<T>::min(), std::strong_ordering::greater};
+    }
+    if (std::cmp_greater(source, std::numeric_limits<T>::max())) {
+      return {std::numeric_limits<T>::max(), std::strong_ordering::less};
+    }
+    return {static_cast<T>(source), std::strong_ordering::equal};
+  } else {
+    Assert(!std::isnan(source), "Cannot compare integers with NaN.");
+    // the bounds are powers of two, so they are exact as floating-point numbers
+    constexpr auto lower_bound = static_cast<Source>(std::numeric_limits<T>::min());
+    if (source < lower_bound) return {std::numeric_limits<T>::min(), std::strong_ordering::greater};
+    if (source >= -lower_bound) return {std::numeric_limits<T>::max(), std::strong_ordering::less};
+    const auto truncated = std::trunc(source);
+    const auto ordering = truncated < source   ? std::strong_ordering::less
+                          : truncated > source ? std::strong_ordering::greater
+                                               : std::strong_ordering::equal;
+    return {static_cast<T>(truncated), ordering};
+  }
+}
+
+// Converts the search value to the data type T of the scanned column and returns it along with a scan type that
+// selects the same rows as "value <scan_type> search_value". For integral columns, type_cast would truncate search
+// values that are not integers or out of range, so that, e.g., x < 3.5 would miss 3. Instead, the scan type is
+// adjusted to the converted value: x < 3.5 becomes x <= 3 and x > -0.5 becomes x >= 0. An equality predicate matches
+// nothing and an inequality predicate every value, which is expressed as a comparison with the minimum of T.
+template <typename T>
+std::pair<ScanType, T> cast_search_value(const ScanType scan_type, const AllTypeVariant& search_value) {
+  return search_value.visit([&](const auto& value) -> std::pair<ScanType, T> {
+    using SourceType = std::decay_t<decltype(value)>;
+    if constexpr (!std::is_integral_v<T> || !std::is_arithmetic_v<SourceType> || std::is_same_v<T, SourceType>) {
+      return {scan_type, type_cast<T>(search_value)};
+    } else {
+      const auto [converted, ordering] = convert_search_number<T>(value);
+      if (ordering == std::strong_ordering::equal) return {scan_type, converted};
+
+      const auto converted_is_less = ordering == std::strong_ordering::less;
+      switch (scan_type) {
+        case ScanType::OpEquals:
+          return {ScanType::OpLessThan, std::numeric_limits<T>::min()};
+        case ScanType::OpNotEquals:
+          return {ScanType::OpGreaterThanEquals, std::numeric_limits<T>::min()};
+        case ScanType::OpLessThan:
+        case ScanType::OpLessThanEquals:
+          return {converted_is_less ? ScanType::OpLessThanEquals : ScanType::OpLessThan, converted};
+        case ScanType::OpGreaterThan:
+        case ScanType::OpGreaterThanEquals:
+          return {converted_is_less ? ScanType::OpGreaterThan : ScanType::OpGreaterThanEquals, converted};
+      }
+      Fail("Unsupported ScanType.");
+    }
+  });
+}
+
+// The value ids of a DictionarySegment that satisfy a predicate: all ids in [begin, end), or all ids outside of it if
+// negated. Since the dictionary is sorted, every ScanType can be expressed this way.
+struct ValueIDRange {
+  ValueID::base_type begin;
+  ValueID::base_type end;
+  bool negated;
+};
+
+template <typename T>
+ValueIDRange value_id_range(const DictionarySegment<T>& segment, const ScanType scan_type, const T& search_value) {
+  const auto unique_values_count = static_cast<ValueID::base_type>(segment.unique_values_count());
+  // INVALID_VALUE_ID means that no dictionary entry is large enough, i.e., the bound is the end of the dictionary
+  const auto to_bound = [&](const ValueID value_id) {
+    return value_id == INVALID_VALUE_ID ? unique_values_count : static_cast<ValueID::base_type>(value_id);
+  };
+  const auto lower_bound = to_bound(segment.lower_bound(search_value));
+  const auto upper_bound = to_bound(segment.upper_bound(search_value));
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return {lower_bound, upper_bound, false};
+    case ScanType::OpNotEquals:
+      return {lower_bound, upper_bound, true};
+    case ScanType::OpLessThan:
+      return {0, lower_bound, false};
+    case ScanType::OpLessThanEquals:
+      return {0, upper_bound, false};
+    case ScanType::OpGreaterThan:
+      return {upper_bound, unique_values_count, false};
+    case ScanType::OpGreaterThanEquals:
+      return {lower_bound, unique_values_count, false};
+  }
+  Fail("Unsupported ScanType.");
+}
+
+// Returns whether no value in [statistics.min, statistics.max] satisfies "value <scan_type> search_value", so that the
+// chunk can be skipped without looking at its segment.
+template <typename T>
+bool can_skip_segment(const SegmentStatistics& statistics, const ScanType scan_type, const T& search_value) {
+  // the segment holds NULLs only, which never match
+  if (variant_is_null(statistics.min)) return true;
+
+  const auto& min = get<T>(statistics.min);
+  const auto& max = get<T>(statistics.max);
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return search_value < min || max < search_value;
+    case ScanType::OpNotEquals:
+      return min == search_value && max == search_value;
+    case ScanType::OpLessThan:
+      return !(min < search_value);
+    case ScanType::OpLessThanEquals:
+      return search_value < min;
+    case ScanType::OpGreaterThan:
+      return !(search_value < max);
+    case ScanType::OpGreaterThanEquals:
+      return max < search_value;
+  }
+  Fail("Unsupported ScanType.");
+}
+
+// Creates a chunk of ReferenceSegments for the matching rows of an input chunk. Segments that are ReferenceSegments
+// themselves are resolved, so that the output never references another ReferenceSegment.
+std::unique_ptr<Chunk> create_reference_chunk(const std::shared_ptr<const Table>& input_table, const Chunk& input_chunk,
+                                              const std::shared_ptr<const PosList>& matches) {
+  auto output_chunk = std::make_unique<Chunk>();
+
+  // The columns of a chunk of ReferenceSegments commonly share their PosList, so each PosList is only filtered once.
+  auto filtered_pos_lists = std::unordered_map<std::shared_ptr<const PosList>, std::shared_ptr<const PosList>>{};
+
+  const auto column_count = input_chunk.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto segment = input_chunk.get_segment(column_id);
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+    if (!reference_segment) {
+      output_chunk->add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, matches));
+      continue;
+    }
+
+    auto& filtered_pos_list = filtered_pos_lists[reference_segment->pos_list()];
+    if (!filtered_pos_list) {
+      const auto& input_pos_list = *reference_segment->pos_list();
+      auto pos_list = std::make_shared<PosList>();
+      pos_list->reserve(matches->size());
+      for (const auto& match : *matches) {
+        pos_list->emplace_back(input_pos_list[match.chunk_offset]);
+      }
+      filtered_pos_list = pos_list;
+    }
+    output_chunk->add_segment(std::make_shared<ReferenceSegment>(
+        reference_segment->referenced_table(), reference_segment->referenced_column_id(), filtered_pos_list));
+  }
+
+  return output_chunk;
+}
+
+}  // namespace
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                     const ScanType scan_type, const AllTypeVariant search_value)
+    : AbstractOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {}
+
+ColumnID TableScan::column_id() const { return _column_id; }
+
+ScanType TableScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  const auto input_table = _left_input_table();
+
+  auto output_table = std::make_shared<Table>(input_table->target_chunk_size());
+  const auto column_count = input_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  // Comparisons with NULL are never true.
+  if (variant_is_null(_search_value)) return output_table;
+
+  resolve_data_type(input_table->column_type(_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto cast_search = cast_search_value<ColumnDataType>(_scan_type, _search_value);
+    const auto scan_type = cast_search.first;
+    const auto& search_value = cast_search.second;
+
+    // Chunks are scanned in parallel. Each task only writes the matches of its own chunk.
+    const auto chunk_count = input_table->chunk_count();
+    auto matches_per_chunk = std::vector<std::shared_ptr<PosList>>(chunk_count);
+    TaskScheduler::get().for_each_chunk(chunk_count, [&](const ChunkID chunk_id) {
+      auto matches = std::make_shared<PosList>();
+      const auto chunk = input_table->get_chunk(chunk_id);
+      const auto statistics = chunk->statistics();
+      if (!statistics || !can_skip_segment((*statistics)[_column_id], scan_type, search_value)) {
+        _scan_segment<ColumnDataType>(*chunk->get_segment(_column_id), chunk_id, scan_type, search_value, *matches);
+      }
+      matches_per_chunk[chunk_id] = std::move(matches);
+    });
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& matches = matches_per_chunk[chunk_id];
+      if (matches->empty()) continue;
+
+      output_table->emplace_chunk(create_reference_chunk(input_table, *input_table->get_chunk(chunk_id), matches));
+    }
+  });
+
+  return output_table;
+}
+
+template <typename T>
+void TableScan::_scan_segment(const BaseSegment& segment, const ChunkID chunk_id, const ScanType scan_type,
+                              const T& search_value, PosList& pos_list) const {
+  const auto size = segment.size();
+
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+      const auto* values = typed_segment.values().data();
+      auto null_words = std::array<uint64_t, SCAN_BLOCK_SIZE / 64>{};
+      auto mask = BlockMask{};
+      with_comparator(scan_type, [&](auto comparator) {
+        for (auto block_begin = ChunkOffset{0}; block_begin < size; block_begin += SCAN_BLOCK_SIZE) {
+          const auto block_size = std::min(SCAN_BLOCK_SIZE, size_t{size} - block_begin);
+          const auto* block_values = values + block_begin;
+          for (auto word_index = size_t{0}; word_index < null_words.size(); ++word_index) {
+            null_words[word_index] = typed_segment.null_bitmap_word(block_begin / 64 + word_index);
+          }
+          evaluate_block(block_size, [&](const size_t index) { return comparator(block_values[index], search_value); },
+                         mask);
+          // NULLs never match, so the result of the comparison is masked with the null bitmap
+          mask_nulls(null_words.data(), block_size, mask);
+          compact_block(chunk_id, block_begin, block_size, mask, pos_list);
+        }
+      });
+    } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+      // Instead of comparing values of type T, the predicate is rewritten to a range of value ids and only the
+      // attribute vector is scanned.
+      const auto range = value_id_range(typed_segment, scan_type, search_value);
+      const auto range_size = range.end > range.begin ? range.end - range.begin : 0;
+      const auto unique_values_count = typed_segment.unique_values_count();
+      if (range_size == (range.negated ? unique_values_count : 0)) return;
+
+      const auto& attribute_vector = *typed_segment.attribute_vector();
+      auto value_ids = std::array<ValueID, SCAN_BLOCK_SIZE>{};
+      auto mask = BlockMask{};
+      for (auto block_begin = ChunkOffset{0}; block_begin < size; block_begin += SCAN_BLOCK_SIZE) {
+        const auto block_size = std::min(SCAN_BLOCK_SIZE, size_t{size} - block_begin);
+        attribute_vector.decode(block_begin, block_begin + block_size, value_ids.data());
+        // A single unsigned comparison checks begin <= value_id < end, values below begin wrap around. The NULL value
+        // id lies past the dictionary and would match negated ranges, so these matches are masked out.
+        evaluate_block(block_size,
+                       [&](const size_t index) {
+                         const auto value_id = static_cast<ValueID::base_type>(value_ids[index]);
+                         return ((value_id - range.begin < range_size) != range.negated) &
+                                (value_id < unique_values_count);
+                       },
+                       mask);
+        compact_block(chunk_id, block_begin, block_size, mask, pos_list);
+      }
+    } else if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
+      // The predicate is evaluated once per run, the positions of a matching run are appended as a whole.
+      const auto& values = typed_segment.values();
+      const auto& null_values = typed_segment.null_values();
+      const auto& end_positions = typed_segment.end_positions();
+      with_comparator(scan_type, [&](auto comparator) {
+        auto run_begin = ChunkOffset{0};
+        for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+          const auto run_end = end_positions[run_index];
+          if (!null_values[run_index] && comparator(values[run_index], search_value)) {
+            for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+              pos_list.emplace_back(RowID{chunk_id, chunk_offset});
+            }
+          }
+          run_begin = run_end;
+        }
+      });
+    } else if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) {
+      using Delta = typename FrameOfReferenceSegment<T>::Delta;
+      constexpr auto BLOCK_SIZE = FrameOfReferenceSegment<T>::BLOCK_SIZE;
+      static_assert(BLOCK_SIZE <= SCAN_BLOCK_SIZE && BLOCK_SIZE % 64 == 0, "Blocks have to fit the scan blocks.");
+      const auto& block_minima = typed_segment.block_minima();
+      const auto& bits_per_delta = typed_segment.bits_per_delta();
+      auto deltas = std::array<Delta, BLOCK_SIZE>{};
+      auto null_words = std::array<uint64_t, BLOCK_SIZE / 64>{};
+      auto mask = BlockMask{};
+      with_comparator(scan_type, [&](auto comparator) {
+        for (auto block_index = size_t{0}; block_index < block_minima.size(); ++block_index) {
+          const auto block_begin = static_cast<ChunkOffset>(block_index * BLOCK_SIZE);
+          const auto block_size = std::min(size_t{BLOCK_SIZE}, size_t{size} - block_begin);
+          for (auto word_index = size_t{0}; word_index < null_words.size(); ++word_index) {
+            null_words[word_index] = typed_segment.null_bitmap_word(block_begin / 64 + word_index);
+          }
+
+          // The values of the block lie in [minimum, minimum + max_delta]. If the search value is outside of this
+          // frame, all values compare to it like the minimum does.
+          const auto& block_minimum = block_minima[block_index];
+          const auto bits = bits_per_delta[block_index];
+          const auto max_delta = bits == 0 ? Delta{0} : static_cast<Delta>(~uint64_t{0} >> (64 - bits));
+          const auto search_delta =
+              static_cast<Delta>(static_cast<Delta>(search_value) - static_cast<Delta>(block_minimum));
+          if (search_value < block_minimum || search_delta > max_delta) {
+            if (!comparator(block_minimum, search_value)) continue;
+            std::fill_n(mask.begin(), block_size, uint8_t{1});
+            mask_nulls(null_words.data(), block_size, mask);
+            compact_block(chunk_id, block_begin, block_size, mask, pos_list);
+            continue;
+          }
+
+          // Otherwise, the search value is shifted into the frame and compared to the deltas, which keep the order
+          // of the values, without adding the minimum to each of them.
+          typed_segment.decode_deltas(block_index, deltas.data());
+          evaluate_block(block_size, [&](const size_t index) { return comparator(deltas[index], search_delta); }, mask);
+          mask_nulls(null_words.data(), block_size, mask);
+          compact_block(chunk_id, block_begin, block_size, mask, pos_list);
+        }
+      });
+    } else {
+      with_comparator(scan_type, [&](auto comparator) {
+        segment_iterate<T>(typed_segment, [&](const auto& position) {
+          if (!position.is_null() && comparator(position.value(), search_value)) {
+            pos_list.emplace_back(RowID{chunk_id, position.chunk_offset()});
+          }
+        });
+      });
+    }
+  });
+}
+
+}  // namespace opossum
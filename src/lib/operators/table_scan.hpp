@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// Operator that returns all rows of its input for which the value in the given column satisfies the predicate
+// "value <scan_type> search_value". The output consists of ReferenceSegments, one chunk per input chunk with matches.
+// If the input already consists of ReferenceSegments, the output references the same tables as the input does.
+class TableScan : public AbstractOperator {
+ public:
+  TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const ScanType scan_type,
+            const AllTypeVariant search_value);
+
+  ColumnID column_id() const;
+  ScanType scan_type() const;
+  const AllTypeVariant& search_value() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // appends the positions of all rows of the given segment that satisfy "value <scan_type> search_value" to pos_list
+  template <typename T>
+  void _scan_segment(const BaseSegment& segment, const ChunkID chunk_id, const ScanType scan_type,
+                     const T& search_value, PosList& pos_list) const;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+};
+
+}  // namespace opossum
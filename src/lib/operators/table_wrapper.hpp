@@ -0,0 +1,20 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Operator that wraps a table, so that it can be used as an input of other operators.
+class TableWrapper : public AbstractOperator {
+ public:
+  explicit TableWrapper(const std::shared_ptr<const Table> table);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::shared_ptr<const Table> _table;
+};
+
+}  // namespace opossum
@@ -5,13 +5,16 @@
 #include <string>
 #include <utility>
 
-#include <boost/hana/equal.hpp>
-#include <boost/hana/for_each.hpp>
-#include <boost/hana/size.hpp>
+#include <boost/hana/type.hpp>
 
 #include "all_type_variant.hpp"
 #include "utils/assert.hpp"
 
+#include "storage/base_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/value_segment.hpp"
 
 namespace opossum {
@@ -19,9 +22,9 @@ namespace opossum {
 namespace hana = boost::hana;
 
 /**
- * Resolves a type string by passing a hana::type object on to a generic lambda
+ * Resolves a data type by passing a hana::type object on to a generic lambda
  *
- * @param type_string is a string representation of any of the supported data types
+ * @param data_type is any of the supported data types, e.g., the type of a column from Table::column_type()
  * @param func is a generic lambda or similar accepting a hana::type object
  *
  *
@@ -59,7 +62,7 @@ namespace hana = boost::hana;
  *   template <typename T>
  *   process_type(hana::basic_type<T> type);  // note: parameter type needs to be hana::basic_type not hana::type!
  *
- *   resolve_data_type(type_string, [&](auto type) {
+ *   resolve_data_type(data_type, [&](auto type) {
  *     using Type = typename decltype(type)::type;
  *     const auto var = type_cast<Type>(variant_from_elsewhere);
  *     process_variant(var);
@@ -68,14 +71,74 @@ namespace hana = boost::hana;
  *   });
  */
 template <typename Functor>
-void resolve_data_type(const std::string& type_string, const Functor& func) {
-  hana::for_each(data_types, [&](auto x) {
-    if (std::string(hana::first(x)) == type_string) {
-      // The + before hana::second - which returns a reference - converts its return value into a value
-      func(+hana::second(x));
+void resolve_data_type(const DataType data_type, const Functor& func) {
+  // The types are taken from types by the index of the DataType, so that they cannot get out of sync. The compiler
+  // warns about missing cases.
+  switch (data_type) {
+    case DataType::Int:
+      func(data_type_c<DataType::Int>);
+      return;
+    case DataType::Long:
+      func(data_type_c<DataType::Long>);
+      return;
+    case DataType::Float:
+      func(data_type_c<DataType::Float>);
+      return;
+    case DataType::Double:
+      func(data_type_c<DataType::Double>);
+      return;
+    case DataType::String:
+      func(data_type_c<DataType::String>);
       return;
+  }
+  Fail("Unsupported DataType.");
+}
+
+// Resolves a type string, e.g., "int", which is parsed into a DataType first. Code that dispatches on the same type
+// repeatedly should parse it once with data_type_from_string() instead.
+template <typename Functor>
+void resolve_data_type(const std::string& type_string, const Functor& func) {
+  resolve_data_type(data_type_from_string(type_string), func);
+}
+
+/**
+ * Resolves the concrete type of a segment by passing it on to a generic lambda
+ *
+ * @param segment is a segment whose data type T is already known, e.g., from resolve_data_type
+ * @param func is a generic lambda or similar accepting a const reference to the concrete segment type
+ *
+ * This costs one dynamic_cast per segment type and should be used once per segment, not once per value.
+ * Note that ReferenceSegments are not templated, they are passed on as they are.
+ *
+ * Example:
+ *
+ *   resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+ *     using SegmentType = std::decay_t<decltype(typed_segment)>;
+ *     if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+ *       ...
+ *     }
+ *   });
+ */
+template <typename T, typename Functor>
+void resolve_segment_type(const BaseSegment& segment, const Functor& func) {
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    func(*value_segment);
+  } else if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    func(*dictionary_segment);
+  } else if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    func(*run_length_segment);
+  } else if (const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    func(*reference_segment);
+  } else {
+    // FrameOfReferenceSegments only exist for some data types, the functor is not instantiated for the others
+    if constexpr (supports_frame_of_reference_v<T>) {
+      if (const auto* frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+        func(*frame_of_reference_segment);
+        return;
+      }
     }
-  });
+    Fail("Unrecognized segment type.");
+  }
 }
 
 }  // namespace opossum
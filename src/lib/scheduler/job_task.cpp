@@ -0,0 +1,33 @@
+#include "job_task.hpp"
+
+#include <exception>
+#include <functional>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+JobTask::JobTask(std::function<void()> fn) : _fn(std::move(fn)) {}
+
+void JobTask::execute() {
+  DebugAssert(!is_done(), "JobTask must not be executed twice.");
+  try {
+    _fn();
+  } catch (...) {
+    _exception = std::current_exception();
+  }
+  _done.store(true, std::memory_order_release);
+  _done.notify_all();
+}
+
+bool JobTask::is_done() const { return _done.load(std::memory_order_acquire); }
+
+void JobTask::wait() const { _done.wait(false, std::memory_order_acquire); }
+
+void JobTask::rethrow_exception() const {
+  DebugAssert(is_done(), "JobTask has not been executed yet.");
+  if (_exception) std::rethrow_exception(_exception);
+}
+
+}  // namespace opossum
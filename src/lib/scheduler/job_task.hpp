@@ -0,0 +1,34 @@
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <functional>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A JobTask wraps a function so that it can be executed by the TaskScheduler.
+class JobTask : private Noncopyable {
+ public:
+  explicit JobTask(std::function<void()> fn);
+
+  // executes the function, exceptions are caught and stored so that they can be rethrown by the waiting thread
+  void execute();
+
+  // returns whether execute() has finished
+  bool is_done() const;
+
+  // blocks until execute() has finished, e.g., in another thread
+  void wait() const;
+
+  // rethrows the exception thrown by the function, if any, execute() needs to have finished before
+  void rethrow_exception() const;
+
+ protected:
+  const std::function<void()> _fn;
+  std::exception_ptr _exception;
+  std::atomic_bool _done{false};
+};
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#include "task_queue.hpp"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "job_task.hpp"
+
+namespace opossum {
+
+void TaskQueue::push(std::shared_ptr<JobTask> task) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _tasks.emplace_back(std::move(task));
+}
+
+std::shared_ptr<JobTask> TaskQueue::pull() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (_tasks.empty()) return nullptr;
+  auto task = std::move(_tasks.back());
+  _tasks.pop_back();
+  return task;
+}
+
+std::shared_ptr<JobTask> TaskQueue::steal() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (_tasks.empty()) return nullptr;
+  auto task = std::move(_tasks.front());
+  _tasks.pop_front();
+  return task;
+}
+
+}  // namespace opossum
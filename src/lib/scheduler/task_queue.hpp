@@ -0,0 +1,31 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class JobTask;
+
+// The queue of a single worker of the TaskScheduler. The owning worker pushes and pulls tasks at the back, so that
+// recently scheduled (and probably cache-hot) tasks are executed first. Other workers steal the oldest tasks from the
+// front, which keeps contention between owner and thieves low.
+class TaskQueue : private Noncopyable {
+ public:
+  void push(std::shared_ptr<JobTask> task);
+
+  // returns the most recently pushed task or nullptr if the queue is empty
+  std::shared_ptr<JobTask> pull();
+
+  // returns the least recently pushed task or nullptr if the queue is empty
+  std::shared_ptr<JobTask> steal();
+
+ protected:
+  std::deque<std::shared_ptr<JobTask>> _tasks;
+  std::mutex _mutex;
+};
+
+}  // namespace opossum
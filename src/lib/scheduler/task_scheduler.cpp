@@ -0,0 +1,150 @@
+#include "task_scheduler.hpp"
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "job_task.hpp"
+#include "task_queue.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The id of the worker that runs on the current thread, numeric_limits<size_t>::max() if it is not a worker
+thread_local auto current_worker_id = std::numeric_limits<size_t>::max();
+
+}  // namespace
+
+TaskScheduler& TaskScheduler::get() {
+  static TaskScheduler _instance;
+  return _instance;
+}
+
+void TaskScheduler::begin(const size_t worker_count) {
+  Assert(!is_active(), "TaskScheduler has already been started.");
+  Assert(worker_count > 0, "TaskScheduler needs at least one worker.");
+
+  _shutdown = false;
+  _queues.resize(worker_count);
+  for (auto& queue : _queues) {
+    queue = std::make_unique<TaskQueue>();
+  }
+
+  _workers.reserve(worker_count);
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    _workers.emplace_back([this, worker_id] { _worker_loop(worker_id); });
+  }
+}
+
+void TaskScheduler::finish() {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_idle_mutex};
+    _shutdown = true;
+  }
+  _idle_condition.notify_all();
+
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+  _workers.clear();
+  _queues.clear();
+}
+
+bool TaskScheduler::is_active() const { return !_workers.empty(); }
+
+size_t TaskScheduler::worker_count() const { return _workers.size(); }
+
+void TaskScheduler::schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<JobTask>>& tasks) {
+  if (!is_active()) {
+    for (const auto& task : tasks) {
+      task->execute();
+    }
+  } else {
+    // Workers put nested tasks into their own queue. Other threads distribute tasks round-robin, idle workers steal
+    // them from there.
+    const auto is_worker = current_worker_id < _queues.size();
+    for (const auto& task : tasks) {
+      const auto queue_id = is_worker ? current_worker_id : _next_queue_id++ % _queues.size();
+      // A worker may pull the task as soon as it is pushed. Counting it first keeps the count from wrapping around.
+      ++_queued_task_count;
+      _queues[queue_id]->push(task);
+    }
+    _notify_idle_workers();
+
+    const auto own_queue_id = is_worker ? current_worker_id : _next_queue_id++ % _queues.size();
+    for (const auto& task : tasks) {
+      while (!task->is_done()) {
+        if (const auto next_task = _next_task(own_queue_id)) {
+          next_task->execute();
+        } else {
+          // The task is being executed by another thread. Tasks it schedules are executed by that thread or idle
+          // workers, so blocking cannot deadlock.
+          task->wait();
+        }
+      }
+    }
+  }
+
+  for (const auto& task : tasks) {
+    task->rethrow_exception();
+  }
+}
+
+void TaskScheduler::for_each_chunk(const ChunkCount chunk_count, const std::function<void(ChunkID)>& func) {
+  auto tasks = std::vector<std::shared_ptr<JobTask>>{};
+  tasks.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([&func, chunk_id] { func(chunk_id); }));
+  }
+  schedule_and_wait_for_tasks(tasks);
+}
+
+TaskScheduler::~TaskScheduler() {
+  if (is_active()) finish();
+}
+
+void TaskScheduler::_worker_loop(const size_t worker_id) {
+  current_worker_id = worker_id;
+
+  while (true) {
+    if (const auto task = _next_task(worker_id)) {
+      task->execute();
+      continue;
+    }
+
+    auto lock = std::unique_lock<std::mutex>{_idle_mutex};
+    _idle_condition.wait(lock, [&] { return _shutdown || _queued_task_count > 0; });
+    if (_shutdown && _queued_task_count == 0) break;
+  }
+
+  current_worker_id = std::numeric_limits<size_t>::max();
+}
+
+void TaskScheduler::_notify_idle_workers() {
+  // Workers check for tasks while holding the mutex and keep it until they wait. Taking it once after the tasks are
+  // counted makes sure that no worker is between the check and the wait, so that it cannot miss the notification.
+  {
+    const auto lock = std::lock_guard<std::mutex>{_idle_mutex};
+  }
+  _idle_condition.notify_all();
+}
+
+std::shared_ptr<JobTask> TaskScheduler::_next_task(const size_t queue_id) {
+  if (_queued_task_count == 0) return nullptr;
+
+  const auto queue_count = _queues.size();
+  auto task = _queues[queue_id]->pull();
+  for (auto offset = size_t{1}; !task && offset < queue_count; ++offset) {
+    task = _queues[(queue_id + offset) % queue_count]->steal();
+  }
+
+  if (task) --_queued_task_count;
+  return task;
+}
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class JobTask;
+class TaskQueue;
+
+// The TaskScheduler is a singleton that executes JobTasks on a pool of worker threads. Every worker owns a TaskQueue
+// and steals tasks from the queues of other workers once its own queue is empty.
+// As long as the scheduler has not been started with begin(), all tasks are executed by the scheduling thread.
+class TaskScheduler : private Noncopyable {
+ public:
+  static TaskScheduler& get();
+
+  // starts the given number of worker threads
+  void begin(const size_t worker_count = std::max(std::thread::hardware_concurrency(), 1u));
+
+  // stops all worker threads once all queued tasks are done
+  // must not be called while other threads schedule tasks
+  void finish();
+
+  // returns whether worker threads are running
+  bool is_active() const;
+
+  // returns the number of worker threads, 0 if the scheduler is not active
+  size_t worker_count() const;
+
+  // schedules all tasks and blocks until they are done
+  // the calling thread executes tasks itself while waiting, so that tasks may schedule and wait for other tasks
+  // the first exception thrown by any of the tasks is rethrown
+  void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<JobTask>>& tasks);
+
+  // calls func for every ChunkID in [0, chunk_count), as one task per chunk
+  // this is the way for operators to process the chunks of a table in parallel
+  void for_each_chunk(const ChunkCount chunk_count, const std::function<void(ChunkID)>& func);
+
+  ~TaskScheduler();
+
+  TaskScheduler(TaskScheduler&&) = delete;
+
+ protected:
+  TaskScheduler() = default;
+  TaskScheduler& operator=(TaskScheduler&&) = default;
+
+  void _worker_loop(const size_t worker_id);
+
+  // wakes up the idle workers once tasks are pushed
+  void _notify_idle_workers();
+
+  // returns a task from the given queue or, if that is empty, a task stolen from any other queue
+  std::shared_ptr<JobTask> _next_task(const size_t queue_id);
+
+  std::vector<std::unique_ptr<TaskQueue>> _queues;
+  std::vector<std::thread> _workers;
+
+  // the number of tasks that are in or about to be pushed to a queue, i.e., not yet taken by any thread
+  std::atomic<size_t> _queued_task_count{0};
+  std::atomic<size_t> _next_queue_id{0};
+  std::atomic_bool _shutdown{false};
+
+  // idle workers sleep on this condition variable until tasks are pushed
+  std::mutex _idle_mutex;
+  std::condition_variable _idle_condition;
+};
+
+}  // namespace opossum
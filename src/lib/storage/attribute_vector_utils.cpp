@@ -0,0 +1,35 @@
+#include "attribute_vector_utils.hpp"
+
+#include <limits>
+#include <memory>
+
+#include "bit_packed_attribute_vector.hpp"
+#include "fixed_size_attribute_vector.hpp"
+
+namespace opossum {
+
+uint8_t attribute_vector_bits_per_value(const size_t unique_values_count) {
+  for (const auto bits_per_value : {uint8_t{1}, uint8_t{2}, uint8_t{4}}) {
+    if (unique_values_count < (size_t{1} << bits_per_value)) return bits_per_value;
+  }
+
+  if (unique_values_count <= std::numeric_limits<uint8_t>::max()) return 8;
+  if (unique_values_count <= std::numeric_limits<uint16_t>::max()) return 16;
+  return 32;
+}
+
+std::shared_ptr<BaseAttributeVector> make_attribute_vector(const size_t size, const size_t unique_values_count) {
+  const auto bits_per_value = attribute_vector_bits_per_value(unique_values_count);
+  switch (bits_per_value) {
+    case 8:
+      return std::make_shared<FixedSizeAttributeVector<uint8_t>>(size);
+    case 16:
+      return std::make_shared<FixedSizeAttributeVector<uint16_t>>(size);
+    case 32:
+      return std::make_shared<FixedSizeAttributeVector<uint32_t>>(size);
+    default:
+      return std::make_shared<BitPackedAttributeVector>(size, bits_per_value);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <memory>
+
+#include "base_attribute_vector.hpp"
+
+namespace opossum {
+
+// Creates the narrowest attribute vector that is able to store the value ids of a dictionary with the given number of
+// unique values. The largest value id of the vector is kept unused, so that a down-cast INVALID_VALUE_ID can still be
+// told apart from valid value ids.
+std::shared_ptr<BaseAttributeVector> make_attribute_vector(const size_t size, const size_t unique_values_count);
+
+// returns the number of bits per value id of the attribute vector that make_attribute_vector() creates
+uint8_t attribute_vector_bits_per_value(const size_t unique_values_count);
+
+}  // namespace opossum
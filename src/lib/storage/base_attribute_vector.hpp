@@ -19,6 +19,10 @@ class BaseAttributeVector : private Noncopyable {
   // returns the value id at a given position
   virtual ValueID get(const size_t i) const = 0;
 
+  // writes the value ids of the positions [begin, end) to out, which needs to hold at least end - begin entries
+  // prefer this over calling get() for every position, as it costs only a single virtual call per batch
+  virtual void decode(const size_t begin, const size_t end, ValueID* out) const = 0;
+
   // sets the value id at a given position
   virtual void set(const size_t i, const ValueID value_id) = 0;
 
@@ -27,5 +31,8 @@ class BaseAttributeVector : private Noncopyable {
 
   // returns the width of biggest value id in bytes
   virtual AttributeVectorWidth width() const = 0;
+
+  // returns the number of bytes used by the stored value ids
+  virtual size_t estimate_memory_usage() const = 0;
 };
 }  // namespace opossum
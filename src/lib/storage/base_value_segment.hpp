@@ -0,0 +1,31 @@
+#pragma once
+
+#include "all_type_variant.hpp"
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// BaseValueSegment is the type-independent interface of ValueSegments. It allows chunks to fill segments whose
+// storage was allocated upfront from multiple threads, see Chunk::append_concurrently.
+class BaseValueSegment : public BaseSegment {
+ public:
+  // returns the number of values the segment can hold without reallocating its storage
+  virtual ChunkOffset capacity() const = 0;
+
+  // returns whether the value has the data type of the segment, i.e., whether it can be written without conversion
+  virtual bool matches_data_type(const AllTypeVariant& value) const = 0;
+
+  // writes a value to a position in [size(), capacity()) that the caller has reserved
+  // this does not change the size, so concurrent readers do not see the value until it is published
+  virtual void write_reserved(const ChunkOffset chunk_offset, const AllTypeVariant& value) = 0;
+
+  // destroys a value written to a reserved position that is not published, e.g., when writing the rest of its row
+  // failed, so that the position can be written again
+  virtual void discard_reserved(const ChunkOffset chunk_offset) = 0;
+
+  // makes the first `size` values visible to readers, all of which have to be written before
+  virtual void publish(const ChunkOffset size) = 0;
+};
+
+}  // namespace opossum
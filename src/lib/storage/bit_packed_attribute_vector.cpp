@@ -0,0 +1,85 @@
+#include "bit_packed_attribute_vector.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bits_per_value)
+    : _size{size},
+      _bits_per_value{bits_per_value},
+      _values_per_word{static_cast<uint8_t>(64 / bits_per_value)},
+      _value_mask{(uint64_t{1} << bits_per_value) - 1} {
+  Assert(bits_per_value == 1 || bits_per_value == 2 || bits_per_value == 4,
+         "BitPackedAttributeVector only supports 1, 2, or 4 bits per value.");
+  _owned_words.resize((size + _values_per_word - 1) / _values_per_word);
+  _words = _owned_words;
+}
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bits_per_value,
+                                                   std::vector<uint64_t>&& words)
+    : BitPackedAttributeVector{0, bits_per_value} {
+  Assert(words.size() == (size + _values_per_word - 1) / _values_per_word,
+         "Number of words does not match the number of entries.");
+  _size = size;
+  _owned_words = std::move(words);
+  _words = _owned_words;
+}
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bits_per_value,
+                                                   std::span<const uint64_t> words, std::shared_ptr<const void> owner)
+    : BitPackedAttributeVector{0, bits_per_value} {
+  Assert(words.size() == (size + _values_per_word - 1) / _values_per_word,
+         "Number of words does not match the number of entries.");
+  Assert(owner, "Referenced words need an owner.");
+  _size = size;
+  _owner = std::move(owner);
+  _words = words;
+}
+
+ValueID BitPackedAttributeVector::get(const size_t i) const {
+  DebugAssert(i < _size, "Position is out of range.");
+  const auto shift = (i % _values_per_word) * _bits_per_value;
+  return ValueID{static_cast<ValueID::base_type>((_words[i / _values_per_word] >> shift) & _value_mask)};
+}
+
+void BitPackedAttributeVector::decode(const size_t begin, const size_t end, ValueID* out) const {
+  Assert(begin <= end && end <= _size, "Range is out of bounds.");
+  // Shift through one word at a time instead of recomputing word index and shift for every position.
+  auto i = begin;
+  while (i < end) {
+    const auto word_index = i / _values_per_word;
+    auto word = _words[word_index] >> ((i % _values_per_word) * _bits_per_value);
+    const auto word_end = std::min(end, (word_index + 1) * _values_per_word);
+    for (; i < word_end; ++i) {
+      out[i - begin] = ValueID{static_cast<ValueID::base_type>(word & _value_mask)};
+      word >>= _bits_per_value;
+    }
+  }
+}
+
+void BitPackedAttributeVector::set(const size_t i, const ValueID value_id) {
+  Assert(i < _size, "Position is out of range.");
+  Assert(!_owner, "The entries of the attribute vector are read-only.");
+  DebugAssert(value_id <= _value_mask, "ValueID does not fit into the attribute vector.");
+  const auto shift = (i % _values_per_word) * _bits_per_value;
+  auto& word = _owned_words[i / _values_per_word];
+  word = (word & ~(_value_mask << shift)) | ((static_cast<uint64_t>(value_id) & _value_mask) << shift);
+}
+
+size_t BitPackedAttributeVector::size() const { return _size; }
+
+AttributeVectorWidth BitPackedAttributeVector::width() const { return 1; }
+
+size_t BitPackedAttributeVector::estimate_memory_usage() const { return _words.size() * sizeof(uint64_t); }
+
+uint8_t BitPackedAttributeVector::bits_per_value() const { return _bits_per_value; }
+
+std::span<const uint64_t> BitPackedAttributeVector::words() const { return _words; }
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// BitPackedAttributeVector stores value ids using less than one byte per entry. Entries are packed into 64-bit words
+// using 1, 2, or 4 bits each, so that no entry spans two words.
+class BitPackedAttributeVector : public BaseAttributeVector {
+ public:
+  // creates an attribute vector with the given number of entries and bits per entry, all initialized to ValueID{0}
+  BitPackedAttributeVector(const size_t size, const uint8_t bits_per_value);
+
+  // creates an attribute vector that takes over the given packed words
+  BitPackedAttributeVector(const size_t size, const uint8_t bits_per_value, std::vector<uint64_t>&& words);
+
+  // Creates an attribute vector that references packed words owned by another object, e.g., a memory-mapped file,
+  // which it keeps alive. Its entries cannot be set.
+  BitPackedAttributeVector(const size_t size, const uint8_t bits_per_value, std::span<const uint64_t> words,
+                           std::shared_ptr<const void> owner);
+
+  ValueID get(const size_t i) const final;
+
+  void decode(const size_t begin, const size_t end, ValueID* out) const final;
+
+  void set(const size_t i, const ValueID value_id) final;
+
+  size_t size() const final;
+
+  // bit-packed entries are smaller than a byte, the width is rounded up to 1
+  AttributeVectorWidth width() const final;
+
+  size_t estimate_memory_usage() const final;
+
+  // returns the number of bits used per entry
+  uint8_t bits_per_value() const;
+
+  // returns the underlying packed words
+  std::span<const uint64_t> words() const;
+
+ protected:
+  size_t _size;
+  uint8_t _bits_per_value;
+  uint8_t _values_per_word;
+  uint64_t _value_mask;
+
+  // the words are owned either by the attribute vector itself or by _owner, _words refers to them in both cases
+  std::vector<uint64_t> _owned_words;
+  std::shared_ptr<const void> _owner;
+  std::span<const uint64_t> _words;
+};
+
+}  // namespace opossum
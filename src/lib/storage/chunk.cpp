@@ -1,34 +1,115 @@
+#include <algorithm>
 #include <iomanip>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
+#include "base_value_segment.hpp"
 #include "chunk.hpp"
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) { _columns.emplace_back(segment); }
+void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) {
+  const auto value_segment = std::dynamic_pointer_cast<BaseValueSegment>(segment);
+  const auto segment_capacity = value_segment ? value_segment->capacity() : ChunkOffset{0};
+  if (_columns.empty()) {
+    _capacity = segment_capacity;
+    _reserved_row_count = segment->size();
+  } else {
+    _capacity = std::min(_capacity, segment_capacity);
+  }
+  _columns.emplace_back(segment);
+}
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
   Assert(values.size() == column_count(),
               "\"values\" size mismatched the column count while appending a new row.");
+  const auto chunk_offset = _reserved_row_count++;
+  if (chunk_offset < _capacity) {
+    try {
+      _write_reserved_row(chunk_offset, values);
+    } catch (...) {
+      // no other thread appends to the chunk, so the position can be given back
+      --_reserved_row_count;
+      throw;
+    }
+    return;
+  }
+
   const auto column_bounds = ColumnID{column_count()};
   for (auto column_index = ColumnID{0}; column_index < column_bounds; ++column_index) {
     _columns[column_index]->append(values[column_index]);
   }
 }
 
+bool Chunk::append_concurrently(const std::vector<AllTypeVariant>& values) {
+  // Checking first keeps the reservation counter from growing any further once the chunk is full.
+  if (_reserved_row_count.load(std::memory_order_relaxed) >= _capacity) return false;
+
+  Assert(values.size() == column_count(), "\"values\" size mismatched the column count while appending a new row.");
+  // A reserved position has to be published eventually, as the rows behind it wait for it. Thus, the values are
+  // checked before a position is reserved, so that writing them cannot fail.
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    Assert(static_cast<const BaseValueSegment&>(*_columns[column_id]).matches_data_type(values[column_id]),
+           "Value does not match the data type of the column.");
+  }
+
+  const auto chunk_offset = _reserved_row_count.fetch_add(1);
+  if (chunk_offset >= _capacity) return false;
+
+  _write_reserved_row(chunk_offset, values);
+  return true;
+}
+
+ChunkOffset Chunk::capacity() const { return _capacity; }
+
+void Chunk::_write_reserved_row(const ChunkOffset chunk_offset, const std::vector<AllTypeVariant>& values) {
+  const auto column_bounds = ColumnID{column_count()};
+  auto column_id = ColumnID{0};
+  try {
+    for (; column_id < column_bounds; ++column_id) {
+      static_cast<BaseValueSegment&>(*_columns[column_id]).write_reserved(chunk_offset, values[column_id]);
+    }
+  } catch (...) {
+    // the values written so far are discarded, so that the position can be reused (see append)
+    for (; column_id > 0; --column_id) {
+      static_cast<BaseValueSegment&>(*_columns[column_id - 1]).discard_reserved(chunk_offset);
+    }
+    throw;
+  }
+
+  // Rows are published in the order of their positions. Writers usually reach this point in about that order, so
+  // they only briefly wait for the ones in front of them.
+  while (size() != chunk_offset) {
+    std::this_thread::yield();
+  }
+
+  // size() is read from the first segment, which is published last. Thus, a row is visible only once it is visible
+  // in all segments.
+  for (column_id = column_bounds; column_id > 0; --column_id) {
+    static_cast<BaseValueSegment&>(*_columns[column_id - 1]).publish(chunk_offset + 1);
+  }
+}
+
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
   return _columns.at(column_id);
 }
 
+std::shared_ptr<const ChunkStatistics> Chunk::statistics() const { return _statistics.load(); }
+
+void Chunk::set_statistics(std::shared_ptr<const ChunkStatistics> statistics) {
+  Assert(!statistics || statistics->size() == column_count(), "Expected statistics for every segment.");
+  _statistics.store(std::move(statistics));
+}
+
 ColumnCount Chunk::column_count() const { return ColumnCount{static_cast<uint16_t>(_columns.size())}; }
 
 ChunkOffset Chunk::size() const {
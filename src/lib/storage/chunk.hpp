@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "segment_statistics.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -37,11 +38,39 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  // Adds a new row to a chunk whose ValueSegments were allocated upfront. Unlike append, this can be called by
+  // multiple threads at the same time: every row reserves its position with an atomic increment and is written to
+  // the segments directly. Rows become visible in the order of their positions, so that readers always see a
+  // gap-free prefix of the chunk. The values have to match the data types of the segments, as they are not converted.
+  // Returns false without adding the row if the chunk is full.
+  bool append_concurrently(const std::vector<AllTypeVariant>& values);
+
+  // returns the number of rows that fit into the storage allocated upfront by the segments of the chunk
+  // this is 0 if not all segments are ValueSegments
+  ChunkOffset capacity() const;
+
   // Returns the segment at a given position
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  // Returns the statistics of the segments, or nullptr if they are not computed (yet). Tables compute them once a
+  // chunk is compressed, so that its rows no longer change and rows can be added without scanning them again.
+  std::shared_ptr<const ChunkStatistics> statistics() const;
+
+  // sets the statistics, which other threads might read at the same time
+  void set_statistics(std::shared_ptr<const ChunkStatistics> statistics);
+
  protected:
+  // writes a row to its reserved position and publishes it once all rows in front of it are published
+  void _write_reserved_row(const ChunkOffset chunk_offset, const std::vector<AllTypeVariant>& values);
+
   std::vector<std::shared_ptr<BaseSegment>> _columns;
+
+  ChunkOffset _capacity{0};
+
+  // the number of positions taken by rows, including the ones that are not published yet
+  std::atomic<ChunkOffset> _reserved_row_count{0};
+
+  std::atomic<std::shared_ptr<const ChunkStatistics>> _statistics;
 };
 
 }  // namespace opossum
@@ -1,78 +1,171 @@
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "attribute_vector_utils.hpp"
+#include "base_attribute_vector.hpp"
+#include "base_segment.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/size_estimation_utils.hpp"
+#include "value_segment.hpp"
 
 namespace opossum {
 
-class BaseAttributeVector;
-class BaseSegment;
-
 // Even though ValueIDs do not have to use the full width of ValueID (uint32_t), this will also work for smaller ValueID
 // types (uint8_t, uint16_t) since after a down-cast INVALID_VALUE_ID will look like their numeric_limit::max()
 constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
 
-// Dictionary is a specific segment type that stores all its values in a vector
+// Dictionary is a specific segment type that stores all its values in a vector. The dictionary only holds the non-NULL
+// values, NULLs are encoded as the ValueID one past the last dictionary entry (see null_value_id()).
 template <typename T>
 class DictionarySegment : public BaseSegment {
  public:
   /**
    * Creates a Dictionary segment from a given value segment.
    */
-  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment);
+  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment) {
+    const auto& value_segment = _value_segment(base_segment);
+    const auto values = value_segment.values();
+
+    auto dictionary = std::vector<T>{};
+    dictionary.reserve(values.size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      if (!value_segment.is_null(chunk_offset)) dictionary.emplace_back(values[chunk_offset]);
+    }
+    std::sort(dictionary.begin(), dictionary.end());
+    dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
+    dictionary.shrink_to_fit();
+    if constexpr (std::is_same_v<T, std::string>) {
+      // std::unique move-assigns the remaining strings, which keep the buffers of the strings they overwrote
+      for (auto& value : dictionary) value.shrink_to_fit();
+    }
+    _dictionary = std::make_shared<const std::vector<T>>(std::move(dictionary));
+
+    _encode(value_segment);
+  }
+
+  /**
+   * Creates a Dictionary segment from a given value segment that uses the given, possibly shared, dictionary instead
+   * of building its own. The dictionary has to be sorted, deduplicated, and contain all non-NULL values of the segment.
+   */
+  DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment, std::shared_ptr<const std::vector<T>> dictionary)
+      : _dictionary{std::move(dictionary)} {
+    DebugAssert(std::is_sorted(_dictionary->cbegin(), _dictionary->cend()), "Dictionary has to be sorted.");
+    _encode(_value_segment(base_segment));
+  }
 
-  // SEMINAR INFORMATION: Since most of these methods depend on the template parameter, you will have to implement
-  // the DictionarySegment in this file. Replace the method signatures with actual implementations.
+  /**
+   * Creates a Dictionary segment from an already sorted and deduplicated dictionary and the matching attribute vector.
+   */
+  DictionarySegment(std::shared_ptr<const std::vector<T>> dictionary,
+                    std::shared_ptr<BaseAttributeVector> attribute_vector)
+      : _dictionary{std::move(dictionary)}, _attribute_vector{std::move(attribute_vector)} {
+    DebugAssert(std::is_sorted(_dictionary->cbegin(), _dictionary->cend()), "Dictionary has to be sorted.");
+  }
 
   // return the value at a certain position. If you want to write efficient operators, back off!
-  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override {
+    const auto value_id = _attribute_vector->get(chunk_offset);
+    if (value_id == null_value_id()) return NULL_VALUE;
+    return value_by_value_id(value_id);
+  }
 
-  // return the value at a certain position.
-  T get(const size_t chunk_offset) const;
+  // return the value at a certain position. Fails for NULLs.
+  T get(const size_t chunk_offset) const { return value_by_value_id(_attribute_vector->get(chunk_offset)); }
 
   // dictionary segments are immutable
-  void append(const AllTypeVariant& val) override;
+  void append(const AllTypeVariant& val) override { Fail("DictionarySegment is immutable."); }
 
   // returns an underlying dictionary
-  std::shared_ptr<const std::vector<T>> dictionary() const;
+  std::shared_ptr<const std::vector<T>> dictionary() const { return _dictionary; }
 
   // returns an underlying data structure
-  std::shared_ptr<const BaseAttributeVector> attribute_vector() const;
+  std::shared_ptr<const BaseAttributeVector> attribute_vector() const { return _attribute_vector; }
 
   // return the value represented by a given ValueID
-  const T& value_by_value_id(ValueID value_id) const;
+  const T& value_by_value_id(ValueID value_id) const { return _dictionary->at(value_id); }
 
   // returns the first value ID that refers to a value >= the search value
   // returns INVALID_VALUE_ID if all values are smaller than the search value
-  ValueID lower_bound(T value) const;
+  ValueID lower_bound(T value) const {
+    const auto iter = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+    return _value_id_from_iterator(iter);
+  }
 
   // same as lower_bound(T), but accepts an AllTypeVariant
-  ValueID lower_bound(const AllTypeVariant& value) const;
+  ValueID lower_bound(const AllTypeVariant& value) const { return lower_bound(type_cast<T>(value)); }
 
   // returns the first value ID that refers to a value > the search value
   // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
-  ValueID upper_bound(T value) const;
+  ValueID upper_bound(T value) const {
+    const auto iter = std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+    return _value_id_from_iterator(iter);
+  }
 
   // same as upper_bound(T), but accepts an AllTypeVariant
-  ValueID upper_bound(const AllTypeVariant& value) const;
+  ValueID upper_bound(const AllTypeVariant& value) const { return upper_bound(type_cast<T>(value)); }
+
+  // returns the ValueID that marks NULLs in the attribute vector. It is not a valid index into the dictionary.
+  ValueID null_value_id() const { return ValueID{static_cast<ValueID::base_type>(_dictionary->size())}; }
 
   // return the number of unique_values (dictionary entries)
-  size_t unique_values_count() const;
+  size_t unique_values_count() const { return _dictionary->size(); }
 
   // return the number of entries
-  ChunkOffset size() const override;
+  ChunkOffset size() const override { return static_cast<ChunkOffset>(_attribute_vector->size()); }
+
+  // returns the calculated memory usage. A dictionary shared with other segments is counted by each of them, see
+  // Table::memory_usage() for a total that counts it once.
+  size_t estimate_memory_usage() const final {
+    return dictionary_memory_usage() + _attribute_vector->estimate_memory_usage();
+  }
 
-  // returns the calculated memory usage
-  size_t estimate_memory_usage() const final;
+  // returns the calculated memory usage of the dictionary alone
+  size_t dictionary_memory_usage() const { return values_memory_usage(*_dictionary); }
 
  protected:
-  std::shared_ptr<std::vector<T>> _dictionary;
+  static const ValueSegment<T>& _value_segment(const std::shared_ptr<BaseSegment>& base_segment) {
+    const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(base_segment);
+    Assert(value_segment, "DictionarySegment can only be created from a ValueSegment of the same type.");
+    return *value_segment;
+  }
+
+  // fills the attribute vector with the ValueIDs of the values of the given segment in the dictionary
+  void _encode(const ValueSegment<T>& value_segment) {
+    const auto values = value_segment.values();
+    auto has_nulls = false;
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size() && !has_nulls; ++chunk_offset) {
+      has_nulls = value_segment.is_null(chunk_offset);
+    }
+
+    _attribute_vector = make_attribute_vector(values.size(), _dictionary->size() + (has_nulls ? 1 : 0));
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      if (value_segment.is_null(chunk_offset)) {
+        _attribute_vector->set(chunk_offset, null_value_id());
+        continue;
+      }
+      const auto value_id = lower_bound(values[chunk_offset]);
+      Assert(value_id != INVALID_VALUE_ID && value_by_value_id(value_id) == values[chunk_offset],
+             "Dictionary does not contain all values of the segment.");
+      _attribute_vector->set(chunk_offset, value_id);
+    }
+  }
+
+  ValueID _value_id_from_iterator(const typename std::vector<T>::const_iterator iter) const {
+    if (iter == _dictionary->cend()) return INVALID_VALUE_ID;
+    return ValueID{static_cast<ValueID::base_type>(std::distance(_dictionary->cbegin(), iter))};
+  }
+
+  std::shared_ptr<const std::vector<T>> _dictionary;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
 };
 
@@ -0,0 +1,186 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+
+#include "attribute_vector_utils.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "value_segment.hpp"
+
+#include "utils/assert.hpp"
+#include "utils/size_estimation_utils.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Segments of up to SAMPLE_WINDOW_COUNT * SAMPLE_WINDOW_SIZE values are looked at completely. Of larger ones, only
+// SAMPLE_WINDOW_COUNT evenly spaced windows of SAMPLE_WINDOW_SIZE consecutive values are.
+constexpr auto SAMPLE_WINDOW_COUNT = size_t{64};
+constexpr auto SAMPLE_WINDOW_SIZE = size_t{64};
+
+// what the sample tells about the whole segment
+struct SegmentSample {
+  size_t size{0};
+  size_t sampled_count{0};
+  size_t null_count{0};
+
+  // the number of distinct non-NULL values and of runs (including runs of NULLs) in the segment
+  double distinct_count{0};
+  double run_count{0};
+
+  // the average number of bytes taken by a value, including the heap payload of strings
+  double value_size{0};
+
+  // the number of bits needed for the deltas to the block minima of a FrameOfReferenceSegment
+  uint8_t bits_per_delta{0};
+};
+
+template <typename T>
+SegmentSample sample_segment(const ValueSegment<T>& segment) {
+  auto sample = SegmentSample{};
+  sample.size = segment.size();
+  if (sample.size == 0) return sample;
+
+  const auto values = segment.values();
+  const auto is_sampled_completely = sample.size <= SAMPLE_WINDOW_COUNT * SAMPLE_WINDOW_SIZE;
+  const auto window_count = is_sampled_completely ? size_t{1} : SAMPLE_WINDOW_COUNT;
+  const auto window_size = is_sampled_completely ? sample.size : SAMPLE_WINDOW_SIZE;
+  const auto window_stride = is_sampled_completely ? size_t{0} : (sample.size - window_size) / (window_count - 1);
+
+  auto distinct_values = std::unordered_set<T>{};
+  auto non_null_count = size_t{0};
+  auto total_value_size = size_t{0};
+  auto adjacent_pairs = size_t{0};
+  auto run_changes = size_t{0};
+  auto is_sorted = true;
+  auto min = T{};
+  auto max = T{};
+  auto previous_value = T{};
+
+  for (auto window_index = size_t{0}; window_index < window_count; ++window_index) {
+    const auto window_begin = window_index * window_stride;
+    const auto window_end = window_begin + window_size;
+    for (auto chunk_offset = window_begin; chunk_offset < window_end; ++chunk_offset) {
+      const auto offset = static_cast<ChunkOffset>(chunk_offset);
+      const auto is_null = segment.is_null(offset);
+      if (chunk_offset > window_begin) {
+        ++adjacent_pairs;
+        if (is_null != segment.is_null(offset - 1) || (!is_null && values[offset] != values[offset - 1])) {
+          ++run_changes;
+        }
+      }
+
+      if (is_null) {
+        ++sample.null_count;
+        continue;
+      }
+      // sortedness is also checked across windows, NULLs are ignored
+      const auto& value = values[offset];
+      if (non_null_count > 0 && value < previous_value) is_sorted = false;
+      previous_value = value;
+      if (non_null_count == 0 || value < min) min = value;
+      if (non_null_count == 0 || max < value) max = value;
+      ++non_null_count;
+      distinct_values.insert(value);
+      if constexpr (std::is_same_v<T, std::string>) {
+        total_value_size += sizeof(T) + string_heap_size(value);
+      } else {
+        total_value_size += sizeof(T);
+      }
+    }
+  }
+
+  sample.sampled_count = window_count * window_size;
+  const auto scale = static_cast<double>(sample.size) / static_cast<double>(sample.sampled_count);
+  sample.null_count = static_cast<size_t>(std::round(static_cast<double>(sample.null_count) * scale));
+  sample.value_size = non_null_count > 0 ? static_cast<double>(total_value_size) / static_cast<double>(non_null_count)
+                                         : static_cast<double>(sizeof(T));
+
+  // Runs are only observed within windows, so the share of value changes between neighbours is extrapolated.
+  const auto change_rate = adjacent_pairs > 0 ? static_cast<double>(run_changes) / static_cast<double>(adjacent_pairs)
+                                              : 0.0;
+  sample.run_count = 1.0 + change_rate * static_cast<double>(sample.size - 1);
+
+  // Distinct values that repeat within the sample likely make up most of the segment. If hardly any value repeats,
+  // the segment is assumed to hold as many distinct values in proportion as the sample. Sorted values are distinct
+  // exactly once per run.
+  const auto sampled_distinct_count = static_cast<double>(distinct_values.size());
+  if (is_sampled_completely) {
+    sample.distinct_count = sampled_distinct_count;
+  } else if (is_sorted) {
+    sample.distinct_count = sample.run_count;
+  } else if (sampled_distinct_count * 2 <= static_cast<double>(non_null_count)) {
+    sample.distinct_count = sampled_distinct_count;
+  } else {
+    sample.distinct_count = std::min(sampled_distinct_count * scale, static_cast<double>(sample.size));
+  }
+
+  if constexpr (supports_frame_of_reference_v<T>) {
+    if (non_null_count > 0) {
+      using Delta = typename FrameOfReferenceSegment<T>::Delta;
+      auto range = static_cast<Delta>(static_cast<Delta>(max) - static_cast<Delta>(min));
+      // The values of a block of sorted values only span a part of the range.
+      const auto block_count = (sample.size + FrameOfReferenceSegment<T>::BLOCK_SIZE - 1) /
+                               FrameOfReferenceSegment<T>::BLOCK_SIZE;
+      if (is_sorted) range = static_cast<Delta>(range / block_count);
+      sample.bits_per_delta = static_cast<uint8_t>(std::bit_width(range));
+    }
+  }
+  return sample;
+}
+
+// the estimated number of bytes of the segment under each encoding
+template <typename T>
+EncodingType pick_encoding(const SegmentSample& sample) {
+  const auto size = static_cast<double>(sample.size);
+  const auto null_bitmap_size = sample.null_count > 0 ? size / 8 : 0.0;
+
+  auto best_encoding = EncodingType::Unencoded;
+  auto best_size = size * sample.value_size + null_bitmap_size;
+  const auto consider = [&](const EncodingType encoding, const double estimated_size) {
+    if (estimated_size < best_size) {
+      best_encoding = encoding;
+      best_size = estimated_size;
+    }
+  };
+
+  // NULLs take a ValueID of their own
+  const auto unique_values_count = static_cast<size_t>(sample.distinct_count) + (sample.null_count > 0 ? 1 : 0);
+  consider(EncodingType::Dictionary,
+           sample.distinct_count * sample.value_size +
+               size * static_cast<double>(attribute_vector_bits_per_value(unique_values_count)) / 8);
+
+  consider(EncodingType::RunLength, sample.run_count * (sample.value_size + sizeof(ChunkOffset) + 1.0 / 8));
+
+  if constexpr (supports_frame_of_reference_v<T>) {
+    const auto block_count = std::ceil(size / FrameOfReferenceSegment<T>::BLOCK_SIZE);
+    consider(EncodingType::FrameOfReference,
+             size * static_cast<double>(sample.bits_per_delta) / 8 + null_bitmap_size +
+                 block_count * static_cast<double>(sizeof(T) + sizeof(uint8_t) + sizeof(size_t)));
+  }
+  return best_encoding;
+}
+
+}  // namespace
+
+EncodingType advise_encoding(const DataType type, const BaseSegment& segment) {
+  auto encoding = EncodingType::Unencoded;
+  resolve_data_type(type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    const auto* value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment);
+    Assert(value_segment, "Only ValueSegments of the given type can be advised an encoding.");
+    const auto sample = sample_segment(*value_segment);
+    if (sample.size == 0) return;
+    encoding = pick_encoding<ColumnDataType>(sample);
+  });
+  return encoding;
+}
+
+}  // namespace opossum
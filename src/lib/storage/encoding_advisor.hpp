@@ -0,0 +1,17 @@
+#pragma once
+
+#include "all_type_variant.hpp"
+#include "encoding_type.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// Picks the encoding under which a ValueSegment of the given type is expected to take the least memory. The segment
+// is not encoded for this. Instead, the number of distinct values, the number of runs, the range of the values, and
+// whether they are sorted are estimated from a sample of it, from which the size of each encoding is derived. Sampling
+// windows of consecutive values keeps runs and sortedness intact. Returns one of Unencoded, Dictionary, RunLength, and
+// FrameOfReference (only for int and long columns), preferring the earlier one on ties.
+EncodingType advise_encoding(const DataType type, const BaseSegment& segment);
+
+}  // namespace opossum
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <vector>
+
+namespace opossum {
+
+// The encodings a segment can be compressed with. Automatic is not an encoding itself, it leaves the choice to
+// advise_encoding().
+enum class EncodingType { Automatic, Unencoded, Dictionary, RunLength, FrameOfReference };
+
+// The encodings of the segments of a chunk, either one per column or a single one for all columns
+using ChunkEncodingSpec = std::vector<EncodingType>;
+
+}  // namespace opossum
@@ -0,0 +1,74 @@
+#include "fixed_size_attribute_vector.hpp"
+
+#include <limits>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename uintX_t>
+FixedSizeAttributeVector<uintX_t>::FixedSizeAttributeVector(const size_t size)
+    : _owned_value_ids(size), _value_ids{_owned_value_ids} {}
+
+template <typename uintX_t>
+FixedSizeAttributeVector<uintX_t>::FixedSizeAttributeVector(std::vector<uintX_t>&& value_ids)
+    : _owned_value_ids(std::move(value_ids)), _value_ids{_owned_value_ids} {}
+
+template <typename uintX_t>
+FixedSizeAttributeVector<uintX_t>::FixedSizeAttributeVector(std::span<const uintX_t> value_ids,
+                                                            std::shared_ptr<const void> owner)
+    : _owner{std::move(owner)}, _value_ids{value_ids} {
+  Assert(_owner, "Referenced value ids need an owner.");
+}
+
+template <typename uintX_t>
+ValueID FixedSizeAttributeVector<uintX_t>::get(const size_t i) const {
+  Assert(i < _value_ids.size(), "Position is out of range.");
+  return ValueID{_value_ids[i]};
+}
+
+template <typename uintX_t>
+void FixedSizeAttributeVector<uintX_t>::decode(const size_t begin, const size_t end, ValueID* out) const {
+  Assert(begin <= end && end <= _value_ids.size(), "Range is out of bounds.");
+  const auto* value_ids = _value_ids.data();
+  for (auto i = begin; i < end; ++i) {
+    out[i - begin] = ValueID{value_ids[i]};
+  }
+}
+
+template <typename uintX_t>
+void FixedSizeAttributeVector<uintX_t>::set(const size_t i, const ValueID value_id) {
+  DebugAssert(value_id <= std::numeric_limits<uintX_t>::max(), "ValueID does not fit into the attribute vector.");
+  Assert(!_owner, "The value ids of the attribute vector are read-only.");
+  _owned_value_ids.at(i) = static_cast<uintX_t>(value_id);
+}
+
+template <typename uintX_t>
+size_t FixedSizeAttributeVector<uintX_t>::size() const {
+  return _value_ids.size();
+}
+
+template <typename uintX_t>
+AttributeVectorWidth FixedSizeAttributeVector<uintX_t>::width() const {
+  return sizeof(uintX_t);
+}
+
+template <typename uintX_t>
+size_t FixedSizeAttributeVector<uintX_t>::estimate_memory_usage() const {
+  return _value_ids.size() * sizeof(uintX_t);
+}
+
+template <typename uintX_t>
+std::span<const uintX_t> FixedSizeAttributeVector<uintX_t>::value_ids() const {
+  return _value_ids;
+}
+
+template class FixedSizeAttributeVector<uint8_t>;
+template class FixedSizeAttributeVector<uint16_t>;
+template class FixedSizeAttributeVector<uint32_t>;
+
+}  // namespace opossum
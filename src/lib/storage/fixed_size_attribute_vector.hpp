@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// FixedSizeAttributeVector stores value ids using a fixed number of bytes per entry, as given by the
+// unsigned integer type uintX_t (e.g., uint8_t, uint16_t, uint32_t)
+template <typename uintX_t>
+class FixedSizeAttributeVector : public BaseAttributeVector {
+ public:
+  // creates an attribute vector with the given number of entries, all initialized to ValueID{0}
+  explicit FixedSizeAttributeVector(const size_t size);
+
+  // creates an attribute vector that takes over the given value ids
+  explicit FixedSizeAttributeVector(std::vector<uintX_t>&& value_ids);
+
+  // Creates an attribute vector that references value ids owned by another object, e.g., a memory-mapped file, which it
+  // keeps alive. Its value ids cannot be set.
+  FixedSizeAttributeVector(std::span<const uintX_t> value_ids, std::shared_ptr<const void> owner);
+
+  ValueID get(const size_t i) const final;
+
+  void decode(const size_t begin, const size_t end, ValueID* out) const final;
+
+  void set(const size_t i, const ValueID value_id) final;
+
+  size_t size() const final;
+
+  AttributeVectorWidth width() const final;
+
+  size_t estimate_memory_usage() const final;
+
+  // returns the underlying value ids
+  std::span<const uintX_t> value_ids() const;
+
+ protected:
+  // the value ids are owned either by the attribute vector itself or by _owner, _value_ids refers to them in both cases
+  std::vector<uintX_t> _owned_value_ids;
+  std::shared_ptr<const void> _owner;
+  std::span<const uintX_t> _value_ids;
+};
+
+}  // namespace opossum
@@ -0,0 +1,284 @@
+#include "frame_of_reference_segment.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "value_segment.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Number of deltas that are unpacked at once. A group of 64 deltas of b bits each takes exactly b words, so that every
+// group starts at the beginning of a word.
+constexpr auto UNPACK_GROUP_SIZE = size_t{64};
+
+// word index and shift of each delta in a group of deltas of BITS bits each
+template <size_t BITS>
+constexpr auto UNPACK_WORD_INDICES = [] {
+  auto word_indices = std::array<uint32_t, UNPACK_GROUP_SIZE>{};
+  for (auto index = size_t{0}; index < UNPACK_GROUP_SIZE; ++index) word_indices[index] = index * BITS / 64;
+  return word_indices;
+}();
+
+template <size_t BITS>
+constexpr auto UNPACK_SHIFTS = [] {
+  auto shifts = std::array<uint64_t, UNPACK_GROUP_SIZE>{};
+  for (auto index = size_t{0}; index < UNPACK_GROUP_SIZE; ++index) shifts[index] = index * BITS % 64;
+  return shifts;
+}();
+
+// Unpacks group_count groups of deltas of BITS bits each. The word indices and shifts of a group are compile-time
+// constants and every delta is unpacked the same way, also those that do not span two words, so that the compiler
+// vectorizes the loop over a group (into gathers and per-lane shifts with AVX2). Shifting the second word in two steps
+// avoids shifting by 64. The last delta of a group reads the word after the group, which is either the first word of
+// the next group or block or the padding word at the end of _delta_words. Deltas of 64 bits are only copied.
+template <size_t BITS, typename Delta>
+void unpack_groups(const uint64_t* __restrict words, Delta* __restrict out, const size_t group_count) {
+  if constexpr (BITS == 64) {
+    std::copy_n(words, group_count * UNPACK_GROUP_SIZE, out);
+  } else {
+    constexpr auto MASK = (uint64_t{1} << BITS) - 1;
+    for (auto group_index = size_t{0}; group_index < group_count; ++group_index) {
+      const auto* group_words = words + group_index * BITS;
+      auto* group_out = out + group_index * UNPACK_GROUP_SIZE;
+      for (auto index = size_t{0}; index < UNPACK_GROUP_SIZE; ++index) {
+        const auto word_index = UNPACK_WORD_INDICES<BITS>[index];
+        const auto shift = UNPACK_SHIFTS<BITS>[index];
+        const auto delta = (group_words[word_index] >> shift) | ((group_words[word_index + 1] << 1) << (63 - shift));
+        group_out[index] = static_cast<Delta>(delta & MASK);
+      }
+    }
+  }
+}
+
+template <typename Delta>
+using UnpackKernel = void (*)(const uint64_t* words, Delta* out, const size_t group_count);
+
+// Returns the unpack kernels for all delta widths of Delta, with the kernel for b bits at index b - 1. Indexing the
+// array dispatches on the width like a switch does.
+template <typename Delta, size_t... BITS_MINUS_ONE>
+constexpr auto make_unpack_kernels(std::index_sequence<BITS_MINUS_ONE...>) {
+  return std::array<UnpackKernel<Delta>, sizeof...(BITS_MINUS_ONE)>{&unpack_groups<BITS_MINUS_ONE + 1, Delta>...};
+}
+
+template <typename Delta>
+constexpr auto UNPACK_KERNELS = make_unpack_kernels<Delta>(std::make_index_sequence<sizeof(Delta) * 8>{});
+
+}  // namespace
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment) {
+  const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(base_segment);
+  Assert(value_segment, "FrameOfReferenceSegment can only be created from a ValueSegment of the same type.");
+
+  const auto values = value_segment->values();
+  _size = static_cast<ChunkOffset>(values.size());
+  const auto block_count = (size_t{_size} + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _block_minima.reserve(block_count);
+  _bits_per_delta.reserve(block_count);
+
+  auto has_nulls = false;
+  for (auto block_begin = ChunkOffset{0}; block_begin < _size; block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(_size, block_begin + BLOCK_SIZE);
+
+    // the block minimum and the width of the largest delta only take non-NULL values into account
+    auto minimum = std::optional<T>{};
+    for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+      if (value_segment->is_null(chunk_offset)) {
+        has_nulls = true;
+        continue;
+      }
+      if (!minimum || values[chunk_offset] < *minimum) minimum = values[chunk_offset];
+    }
+    const auto block_minimum = minimum.value_or(T{0});
+
+    auto max_delta = Delta{0};
+    for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+      if (value_segment->is_null(chunk_offset)) continue;
+      max_delta = std::max(max_delta, static_cast<Delta>(static_cast<Delta>(values[chunk_offset]) -
+                                                         static_cast<Delta>(block_minimum)));
+    }
+    const auto bits_per_delta = static_cast<uint8_t>(std::bit_width(max_delta));
+
+    const auto block_word_offset = _delta_words.size();
+    _delta_words.resize(block_word_offset + ((block_end - block_begin) * bits_per_delta + 63) / 64);
+    for (auto chunk_offset = block_begin; chunk_offset < block_end && bits_per_delta > 0; ++chunk_offset) {
+      if (value_segment->is_null(chunk_offset)) continue;
+      const auto delta =
+          static_cast<uint64_t>(static_cast<Delta>(static_cast<Delta>(values[chunk_offset]) -
+                                                   static_cast<Delta>(block_minimum)));
+      const auto bit = size_t{chunk_offset - block_begin} * bits_per_delta;
+      const auto shift = bit % 64;
+      auto* word = &_delta_words[block_word_offset + bit / 64];
+      word[0] |= delta << shift;
+      if (shift + bits_per_delta > 64) word[1] |= delta >> (64 - shift);
+    }
+
+    _block_minima.emplace_back(block_minimum);
+    _bits_per_delta.emplace_back(bits_per_delta);
+  }
+  _delta_words.emplace_back(0);
+  _delta_words.shrink_to_fit();
+
+  if (has_nulls) {
+    _null_bitmap.resize((_size + 63) / 64);
+    for (auto word_index = size_t{0}; word_index < _null_bitmap.size(); ++word_index) {
+      _null_bitmap[word_index] = value_segment->null_bitmap_word(word_index);
+    }
+  }
+
+  _compute_block_word_offsets();
+}
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const ChunkOffset size, std::vector<T>&& block_minima,
+                                                    std::vector<uint8_t>&& bits_per_delta,
+                                                    std::vector<uint64_t>&& delta_words,
+                                                    std::vector<uint64_t>&& null_bitmap)
+    : _size{size},
+      _block_minima{std::move(block_minima)},
+      _bits_per_delta{std::move(bits_per_delta)},
+      _delta_words{std::move(delta_words)},
+      _null_bitmap{std::move(null_bitmap)} {
+  Assert(_block_minima.size() == block_count() && _bits_per_delta.size() == block_count(),
+         "Expected a minimum and a delta width per block.");
+  Assert(_null_bitmap.size() <= (_size + 63) / 64, "Null bitmap is larger than the segment.");
+  _compute_block_word_offsets();
+  Assert(_delta_words.size() == _block_word_offsets.back() + 1, "Number of words does not match the blocks.");
+}
+
+template <typename T>
+AllTypeVariant FrameOfReferenceSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  if (is_null(chunk_offset)) return NULL_VALUE;
+  return get(chunk_offset);
+}
+
+template <typename T>
+T FrameOfReferenceSegment<T>::get(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < _size, "Position is out of range.");
+  const auto block_index = chunk_offset / BLOCK_SIZE;
+  const auto bits_per_delta = _bits_per_delta[block_index];
+  if (bits_per_delta == 0) return _block_minima[block_index];
+
+  const auto delta = _unpack(_delta_words.data() + _block_word_offsets[block_index],
+                             size_t{chunk_offset % BLOCK_SIZE} * bits_per_delta, bits_per_delta);
+  return static_cast<T>(static_cast<Delta>(_block_minima[block_index]) + delta);
+}
+
+template <typename T>
+bool FrameOfReferenceSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  return (null_bitmap_word(chunk_offset / 64) >> (chunk_offset % 64)) & 1;
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::append(const AllTypeVariant& val) {
+  Fail("FrameOfReferenceSegment is immutable.");
+}
+
+template <typename T>
+ChunkOffset FrameOfReferenceSegment<T>::size() const {
+  return _size;
+}
+
+template <typename T>
+uint64_t FrameOfReferenceSegment<T>::null_bitmap_word(const size_t word_index) const {
+  return word_index < _null_bitmap.size() ? _null_bitmap[word_index] : 0;
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::block_count() const {
+  return (size_t{_size} + BLOCK_SIZE - 1) / BLOCK_SIZE;
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::decode_deltas(const size_t block_index, Delta* out) const {
+  const auto block_size = std::min(size_t{BLOCK_SIZE}, _size - block_index * BLOCK_SIZE);
+  const auto bits_per_delta = _bits_per_delta[block_index];
+  if (bits_per_delta == 0) {
+    std::fill_n(out, block_size, Delta{0});
+    return;
+  }
+
+  // Full groups of deltas are unpacked by the kernel for the width of the block, the deltas of a last, partial group
+  // one by one.
+  static_assert(BLOCK_SIZE % UNPACK_GROUP_SIZE == 0, "Only the last block of a segment may end in a partial group.");
+  const auto* words = _delta_words.data() + _block_word_offsets[block_index];
+  const auto group_count = block_size / UNPACK_GROUP_SIZE;
+  UNPACK_KERNELS<Delta>[bits_per_delta - 1](words, out, group_count);
+  for (auto index = group_count * UNPACK_GROUP_SIZE; index < block_size; ++index) {
+    out[index] = _unpack(words, index * bits_per_delta, bits_per_delta);
+  }
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::decode_block(const size_t block_index, T* out) const {
+  const auto block_size = std::min(size_t{BLOCK_SIZE}, _size - block_index * BLOCK_SIZE);
+  auto* deltas = reinterpret_cast<Delta*>(out);
+  decode_deltas(block_index, deltas);
+  const auto block_minimum = static_cast<Delta>(_block_minima[block_index]);
+  for (auto index = size_t{0}; index < block_size; ++index) {
+    out[index] = static_cast<T>(block_minimum + deltas[index]);
+  }
+}
+
+template <typename T>
+const std::vector<T>& FrameOfReferenceSegment<T>::block_minima() const {
+  return _block_minima;
+}
+
+template <typename T>
+const std::vector<uint8_t>& FrameOfReferenceSegment<T>::bits_per_delta() const {
+  return _bits_per_delta;
+}
+
+template <typename T>
+const std::vector<uint64_t>& FrameOfReferenceSegment<T>::delta_words() const {
+  return _delta_words;
+}
+
+template <typename T>
+const std::vector<uint64_t>& FrameOfReferenceSegment<T>::null_bitmap() const {
+  return _null_bitmap;
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::estimate_memory_usage() const {
+  return _block_minima.size() * sizeof(T) + _bits_per_delta.size() + _delta_words.size() * sizeof(uint64_t) +
+         _null_bitmap.size() * sizeof(uint64_t) + _block_word_offsets.size() * sizeof(size_t);
+}
+
+template <typename T>
+typename FrameOfReferenceSegment<T>::Delta FrameOfReferenceSegment<T>::_unpack(const uint64_t* words,
+                                                                              const size_t bit,
+                                                                              const uint8_t bits_per_delta) {
+  // The bits taken from the following word are shifted in two steps, so that a shift by 64 yields 0 instead of being
+  // undefined.
+  DebugAssert(bits_per_delta > 0, "Blocks without deltas are not unpacked.");
+  const auto shift = bit % 64;
+  const auto packed = (words[bit / 64] >> shift) | ((words[bit / 64 + 1] << 1) << (63 - shift));
+  return static_cast<Delta>(packed & (~uint64_t{0} >> (64 - bits_per_delta)));
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::_compute_block_word_offsets() {
+  _block_word_offsets.resize(block_count() + 1);
+  _block_word_offsets[0] = 0;
+  for (auto block_index = size_t{0}; block_index < block_count(); ++block_index) {
+    const auto block_size = std::min(size_t{BLOCK_SIZE}, _size - block_index * BLOCK_SIZE);
+    _block_word_offsets[block_index + 1] =
+        _block_word_offsets[block_index] + (block_size * _bits_per_delta[block_index] + 63) / 64;
+  }
+}
+
+template class FrameOfReferenceSegment<int32_t>;
+template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
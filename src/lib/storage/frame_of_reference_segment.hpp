@@ -0,0 +1,96 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// whether FrameOfReferenceSegment supports the data type T
+template <typename T>
+constexpr bool supports_frame_of_reference_v = std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>;
+
+// FrameOfReferenceSegment is a segment type for int and long columns whose values lie in a narrow range. The values are
+// split into blocks of BLOCK_SIZE. For every block, it stores the minimum (the frame of reference) and the differences
+// of the values to it (deltas), which are bit-packed with as many bits as the largest delta of the block needs. Unlike
+// a DictionarySegment, it does not depend on the number of distinct values. NULLs are marked in a separate bitmap.
+//
+// Operators decode a whole block at once with decode_deltas() or decode_block() and can compare the deltas to a search
+// value that is shifted by the block minimum, without adding the minimum to every value.
+template <typename T>
+class FrameOfReferenceSegment : public BaseSegment {
+  static_assert(supports_frame_of_reference_v<T>, "FrameOfReferenceSegment only supports int and long columns.");
+
+ public:
+  using Delta = std::make_unsigned_t<T>;
+
+  static constexpr auto BLOCK_SIZE = ChunkOffset{1024};
+
+  // creates a FrameOfReferenceSegment from the values of a ValueSegment of the same type
+  explicit FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // Creates a FrameOfReferenceSegment from already encoded blocks. The deltas of a block start at the word following
+  // the ones of the previous block. The null bitmap has the layout described at null_bitmap_word() and may be empty.
+  FrameOfReferenceSegment(const ChunkOffset size, std::vector<T>&& block_minima, std::vector<uint8_t>&& bits_per_delta,
+                          std::vector<uint64_t>&& delta_words, std::vector<uint64_t>&& null_bitmap);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // return the value at a certain position. The value of a NULL is unspecified.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // returns whether the value at the given position is NULL
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // FrameOfReferenceSegments are immutable
+  void append(const AllTypeVariant& val) final;
+
+  // return the number of entries
+  ChunkOffset size() const final;
+
+  // returns 64 entries of the null bitmap in the layout of ValueSegment::null_bitmap_word()
+  uint64_t null_bitmap_word(const size_t word_index) const;
+
+  size_t block_count() const;
+
+  // Writes the deltas of the values of a block to out, which has to hold BLOCK_SIZE entries. The deltas are unpacked in
+  // groups of 64 by a kernel that is specialized for the delta width of the block and vectorized by the compiler. The
+  // deltas of NULLs are 0.
+  void decode_deltas(const size_t block_index, Delta* out) const;
+
+  // writes the values of a block to out, which has to hold BLOCK_SIZE entries
+  void decode_block(const size_t block_index, T* out) const;
+
+  // the encoded blocks, as passed to the constructor
+  const std::vector<T>& block_minima() const;
+  const std::vector<uint8_t>& bits_per_delta() const;
+  const std::vector<uint64_t>& delta_words() const;
+  const std::vector<uint64_t>& null_bitmap() const;
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  // returns the delta that starts at the given bit of a block, which may span two words. Deltas have at least 1 bit.
+  static Delta _unpack(const uint64_t* words, const size_t bit, const uint8_t bits_per_delta);
+
+  // computes the position of the first word of every block, followed by the number of words used by all blocks
+  void _compute_block_word_offsets();
+
+  ChunkOffset _size{0};
+  std::vector<T> _block_minima;
+  std::vector<uint8_t> _bits_per_delta;
+
+  // The packed deltas of all blocks, followed by a word of padding. The padding allows _unpack() to read the word
+  // following the one a delta starts in unconditionally.
+  std::vector<uint64_t> _delta_words;
+
+  std::vector<uint64_t> _null_bitmap;
+  std::vector<size_t> _block_word_offsets;
+};
+
+}  // namespace opossum
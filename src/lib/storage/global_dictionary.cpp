@@ -0,0 +1,61 @@
+#include "global_dictionary.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+GlobalDictionary<T>::GlobalDictionary(std::vector<T>&& values) {
+  std::sort(values.begin(), values.end());
+  values.erase(std::unique(values.begin(), values.end()), values.end());
+  values.shrink_to_fit();
+  if constexpr (std::is_same_v<T, std::string>) {
+    // std::unique move-assigns the remaining strings, which keep the buffers of the strings they overwrote
+    for (auto& value : values) value.shrink_to_fit();
+  }
+  _values = std::make_shared<const std::vector<T>>(std::move(values));
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> GlobalDictionary<T>::values() const {
+  return _values;
+}
+
+std::shared_ptr<BaseGlobalDictionary> build_global_dictionary(
+    const std::vector<std::pair<std::shared_ptr<const Table>, ColumnID>>& columns) {
+  Assert(!columns.empty(), "A global dictionary needs at least one column.");
+  const auto type = columns.front().first->column_type(columns.front().second);
+
+  auto global_dictionary = std::shared_ptr<BaseGlobalDictionary>{};
+  resolve_data_type(type, [&](auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    auto values = std::vector<ColumnDataType>{};
+    for (const auto& [table, column_id] : columns) {
+      Assert(table->column_type(column_id) == type, "All columns of a global dictionary must have the same type.");
+      const auto chunk_count = table->chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = table->get_chunk(chunk_id);
+        if (chunk->size() == 0) continue;
+        segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+          if (!position.is_null()) values.emplace_back(position.value());
+        });
+      }
+    }
+    global_dictionary = std::make_shared<GlobalDictionary<ColumnDataType>>(std::move(values));
+  });
+  return global_dictionary;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(GlobalDictionary);
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Base class of GlobalDictionary<T>, so that dictionaries of any data type can be passed to Table::compress_chunk
+class BaseGlobalDictionary : private Noncopyable {
+ public:
+  virtual ~BaseGlobalDictionary() = default;
+};
+
+// A sorted dictionary without duplicates that is shared by the DictionarySegments of several chunks, possibly of
+// different tables. Segments that share a dictionary encode equal values with equal ValueIDs, so that operators can
+// compare values across these segments by their ValueIDs, without decoding them.
+template <typename T>
+class GlobalDictionary : public BaseGlobalDictionary {
+ public:
+  // creates a dictionary of the given values, which do not have to be sorted or unique
+  explicit GlobalDictionary(std::vector<T>&& values);
+
+  // returns the sorted values, which DictionarySegments reference directly
+  std::shared_ptr<const std::vector<T>> values() const;
+
+ protected:
+  std::shared_ptr<const std::vector<T>> _values;
+};
+
+// Creates a GlobalDictionary that holds all non-NULL values of the given columns, which have to be of the same type.
+// Passing the join columns of two tables creates a merged dictionary for both sides of the join.
+std::shared_ptr<BaseGlobalDictionary> build_global_dictionary(
+    const std::vector<std::pair<std::shared_ptr<const Table>, ColumnID>>& columns);
+
+}  // namespace opossum
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// ReferenceSegment is a specific segment type that stores all its values as position list of a referenced segment
+class ReferenceSegment : public BaseSegment {
+ public:
+  // creates a reference segment
+  // the parameters specify the positions and the referenced segment
+  ReferenceSegment(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
+                   const std::shared_ptr<const PosList> pos);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // reference segments are immutable
+  void append(const AllTypeVariant&) override;
+
+  // return the number of entries
+  ChunkOffset size() const override;
+
+  // returns the positions in the referenced table
+  const std::shared_ptr<const PosList> pos_list() const;
+
+  // returns the table that holds the referenced values
+  const std::shared_ptr<const Table> referenced_table() const;
+
+  // returns the column of the referenced table that holds the referenced values
+  ColumnID referenced_column_id() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const PosList> _pos_list;
+};
+
+}  // namespace opossum
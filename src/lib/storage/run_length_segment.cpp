@@ -0,0 +1,96 @@
+#include "run_length_segment.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "value_segment.hpp"
+
+#include "utils/assert.hpp"
+#include "utils/size_estimation_utils.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment) {
+  const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(base_segment);
+  Assert(value_segment, "RunLengthSegment can only be created from a ValueSegment of the same type.");
+
+  const auto values = value_segment->values();
+  const auto size = static_cast<ChunkOffset>(values.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    const auto is_null = value_segment->is_null(chunk_offset);
+    const auto continues_run =
+        !_values.empty() && _null_values.back() == is_null && (is_null || _values.back() == values[chunk_offset]);
+    if (continues_run) {
+      ++_end_positions.back();
+      continue;
+    }
+    _values.emplace_back(is_null ? T{} : values[chunk_offset]);
+    _null_values.push_back(is_null);
+    _end_positions.emplace_back(chunk_offset + 1);
+  }
+
+  _values.shrink_to_fit();
+  _null_values.shrink_to_fit();
+  _end_positions.shrink_to_fit();
+}
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(std::vector<T>&& values, std::vector<bool>&& null_values,
+                                      std::vector<ChunkOffset>&& end_positions)
+    : _values{std::move(values)}, _null_values{std::move(null_values)}, _end_positions{std::move(end_positions)} {
+  Assert(_values.size() == _null_values.size() && _values.size() == _end_positions.size(),
+         "Expected a value, a NULL flag, and an end position per run.");
+  DebugAssert(std::is_sorted(_end_positions.cbegin(), _end_positions.cend()), "End positions have to be sorted.");
+}
+
+template <typename T>
+AllTypeVariant RunLengthSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Position is out of range.");
+  const auto run = run_index(chunk_offset);
+  if (_null_values[run]) return NULL_VALUE;
+  return _values[run];
+}
+
+template <typename T>
+void RunLengthSegment<T>::append(const AllTypeVariant& val) {
+  Fail("RunLengthSegment is immutable.");
+}
+
+template <typename T>
+ChunkOffset RunLengthSegment<T>::size() const {
+  return _end_positions.empty() ? ChunkOffset{0} : _end_positions.back();
+}
+
+template <typename T>
+const std::vector<T>& RunLengthSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+const std::vector<bool>& RunLengthSegment<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+const std::vector<ChunkOffset>& RunLengthSegment<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::run_index(const ChunkOffset chunk_offset) const {
+  const auto run = std::upper_bound(_end_positions.cbegin(), _end_positions.cend(), chunk_offset);
+  return static_cast<size_t>(std::distance(_end_positions.cbegin(), run));
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::estimate_memory_usage() const {
+  return values_memory_usage(_values) + (_null_values.size() + 7) / 8 + values_memory_usage(_end_positions);
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// RunLengthSegment is a segment type that stores consecutive equal values (runs) only once. For every run, it holds
+// the value, whether the run consists of NULLs, and its end position, i.e., the position one past its last row. It is
+// meant for sorted columns and columns with long runs, for which operators evaluate predicates once per run.
+template <typename T>
+class RunLengthSegment : public BaseSegment {
+ public:
+  // creates a RunLengthSegment from the values of a ValueSegment of the same type
+  explicit RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // creates a RunLengthSegment from already encoded runs. The value of a NULL run is not used.
+  RunLengthSegment(std::vector<T>&& values, std::vector<bool>&& null_values, std::vector<ChunkOffset>&& end_positions);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // RunLengthSegments are immutable
+  void append(const AllTypeVariant& val) final;
+
+  // return the number of entries
+  ChunkOffset size() const final;
+
+  // the value, NULL flag, and end position of each run
+  const std::vector<T>& values() const;
+  const std::vector<bool>& null_values() const;
+  const std::vector<ChunkOffset>& end_positions() const;
+
+  // returns the index of the run that holds the given position, which takes a binary search over the end positions
+  size_t run_index(const ChunkOffset chunk_offset) const;
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::vector<T> _values;
+  std::vector<bool> _null_values;
+  std::vector<ChunkOffset> _end_positions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// The position of a value in a segment as passed to the functor of segment_iterate.
+template <typename T>
+class SegmentPosition {
+ public:
+  SegmentPosition(const T& value, const bool is_null, const ChunkOffset chunk_offset)
+      : _value{value}, _is_null{is_null}, _chunk_offset{chunk_offset} {}
+
+  const T& value() const { return _value; }
+  bool is_null() const { return _is_null; }
+  ChunkOffset chunk_offset() const { return _chunk_offset; }
+
+ private:
+  const T& _value;
+  const bool _is_null;
+  const ChunkOffset _chunk_offset;
+};
+
+namespace detail {
+
+// the value passed for NULLs of segments that do not store a value for them
+template <typename T>
+const T& null_placeholder() {
+  static const auto placeholder = T{};
+  return placeholder;
+}
+
+// returns the value at the given offset of a ValueSegment, DictionarySegment, or RunLengthSegment, or a placeholder if
+// it is NULL
+template <typename T>
+const T& segment_value(const ValueSegment<T>& segment, const ChunkOffset chunk_offset) {
+  return segment.values()[chunk_offset];
+}
+
+template <typename T>
+const T& segment_value(const DictionarySegment<T>& segment, const ChunkOffset chunk_offset) {
+  const auto value_id = segment.attribute_vector()->get(chunk_offset);
+  if (value_id == segment.null_value_id()) return null_placeholder<T>();
+  return segment.value_by_value_id(value_id);
+}
+
+template <typename T>
+const T& segment_value(const RunLengthSegment<T>& segment, const ChunkOffset chunk_offset) {
+  return segment.values()[segment.run_index(chunk_offset)];
+}
+
+// FrameOfReferenceSegments do not store their values, so the value is returned by value
+template <typename T>
+T segment_value(const FrameOfReferenceSegment<T>& segment, const ChunkOffset chunk_offset) {
+  return segment.get(chunk_offset);
+}
+
+// returns whether the value at the given offset of an encoded segment is NULL
+template <typename T>
+bool segment_is_null(const ValueSegment<T>& segment, const ChunkOffset chunk_offset) {
+  return segment.is_null(chunk_offset);
+}
+
+template <typename T>
+bool segment_is_null(const DictionarySegment<T>& segment, const ChunkOffset chunk_offset) {
+  return segment.attribute_vector()->get(chunk_offset) == segment.null_value_id();
+}
+
+template <typename T>
+bool segment_is_null(const RunLengthSegment<T>& segment, const ChunkOffset chunk_offset) {
+  return segment.null_values()[segment.run_index(chunk_offset)];
+}
+
+template <typename T>
+bool segment_is_null(const FrameOfReferenceSegment<T>& segment, const ChunkOffset chunk_offset) {
+  return segment.is_null(chunk_offset);
+}
+
+}  // namespace detail
+
+// Number of value ids that are decoded from an attribute vector at once
+constexpr auto SEGMENT_ITERATE_BLOCK_SIZE = size_t{1024};
+
+/**
+ * Calls functor with a SegmentPosition<T> for every value of the segment, in the order of the segment. The value of a
+ * NULL position is unspecified.
+ *
+ * The concrete segment type is resolved only once. Afterwards, values are read from the underlying storage without
+ * constructing an AllTypeVariant or making a virtual call per value. For ReferenceSegments, the referenced segment is
+ * resolved once per run of positions that point into the same chunk.
+ *
+ * Example:
+ *
+ *   auto sum = int64_t{0};
+ *   segment_iterate<int32_t>(segment, [&](const auto& position) {
+ *     if (!position.is_null()) sum += position.value();
+ *   });
+ */
+template <typename T, typename Functor>
+void segment_iterate(const BaseSegment& segment, const Functor& functor) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+      const auto values = typed_segment.values();
+      const auto size = static_cast<ChunkOffset>(values.size());
+      auto null_word = uint64_t{0};
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+        if (chunk_offset % 64 == 0) null_word = typed_segment.null_bitmap_word(chunk_offset / 64);
+        functor(SegmentPosition<T>{values[chunk_offset], static_cast<bool>((null_word >> (chunk_offset % 64)) & 1),
+                                   chunk_offset});
+      }
+    } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+      const auto& dictionary = *typed_segment.dictionary();
+      const auto& attribute_vector = *typed_segment.attribute_vector();
+      const auto size = typed_segment.size();
+      const auto null_value_id = typed_segment.null_value_id();
+
+      auto value_ids = std::array<ValueID, SEGMENT_ITERATE_BLOCK_SIZE>{};
+      for (auto block_begin = ChunkOffset{0}; block_begin < size; block_begin += SEGMENT_ITERATE_BLOCK_SIZE) {
+        const auto block_end =
+            static_cast<ChunkOffset>(std::min(size_t{size}, block_begin + SEGMENT_ITERATE_BLOCK_SIZE));
+        attribute_vector.decode(block_begin, block_end, value_ids.data());
+        for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+          const auto value_id = value_ids[chunk_offset - block_begin];
+          if (value_id == null_value_id) {
+            functor(SegmentPosition<T>{detail::null_placeholder<T>(), true, chunk_offset});
+          } else {
+            functor(SegmentPosition<T>{dictionary[value_id], false, chunk_offset});
+          }
+        }
+      }
+    } else if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
+      const auto& values = typed_segment.values();
+      const auto& null_values = typed_segment.null_values();
+      const auto& end_positions = typed_segment.end_positions();
+
+      auto run_begin = ChunkOffset{0};
+      for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+        const auto is_null = static_cast<bool>(null_values[run_index]);
+        for (auto chunk_offset = run_begin; chunk_offset < end_positions[run_index]; ++chunk_offset) {
+          functor(SegmentPosition<T>{values[run_index], is_null, chunk_offset});
+        }
+        run_begin = end_positions[run_index];
+      }
+    } else if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) {
+      constexpr auto BLOCK_SIZE = FrameOfReferenceSegment<T>::BLOCK_SIZE;
+      const auto size = typed_segment.size();
+      auto values = std::array<T, BLOCK_SIZE>{};
+      for (auto block_begin = ChunkOffset{0}; block_begin < size; block_begin += BLOCK_SIZE) {
+        const auto block_end = std::min(size, block_begin + BLOCK_SIZE);
+        typed_segment.decode_block(block_begin / BLOCK_SIZE, values.data());
+        auto null_word = uint64_t{0};
+        for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+          if (chunk_offset % 64 == 0) null_word = typed_segment.null_bitmap_word(chunk_offset / 64);
+          functor(SegmentPosition<T>{values[chunk_offset - block_begin],
+                                     static_cast<bool>((null_word >> (chunk_offset % 64)) & 1), chunk_offset});
+        }
+      }
+    } else {
+      const auto& pos_list = *typed_segment.pos_list();
+      const auto& referenced_table = *typed_segment.referenced_table();
+      const auto size = typed_segment.size();
+
+      auto run_begin = ChunkOffset{0};
+      while (run_begin < size) {
+        const auto referenced_chunk_id = pos_list[run_begin].chunk_id;
+        auto run_end = run_begin + 1;
+        while (run_end < size && pos_list[run_end].chunk_id == referenced_chunk_id) ++run_end;
+
+        const auto referenced_segment =
+            referenced_table.get_chunk(referenced_chunk_id)->get_segment(typed_segment.referenced_column_id());
+        resolve_segment_type<T>(*referenced_segment, [&](const auto& typed_referenced_segment) {
+          using ReferencedSegmentType = std::decay_t<decltype(typed_referenced_segment)>;
+          if constexpr (std::is_same_v<ReferencedSegmentType, ReferenceSegment>) {
+            Fail("ReferenceSegments must not reference other ReferenceSegments.");
+          } else {
+            for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+              const auto referenced_offset = pos_list[chunk_offset].chunk_offset;
+              const auto& value = detail::segment_value(typed_referenced_segment, referenced_offset);
+              functor(SegmentPosition<T>{value, detail::segment_is_null(typed_referenced_segment, referenced_offset),
+                                         chunk_offset});
+            }
+          }
+        });
+        run_begin = run_end;
+      }
+    }
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,138 @@
+#include "segment_statistics.hpp"
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "dictionary_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "segment_iterate.hpp"
+#include "value_segment.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// computes the statistics of segments that are looked at value by value, i.e., ValueSegments and
+// FrameOfReferenceSegments
+template <typename T>
+SegmentStatistics compute_statistics_by_value(const BaseSegment& segment) {
+  auto statistics = SegmentStatistics{};
+  auto distinct_values = std::unordered_set<T>{};
+  auto min = std::optional<T>{};
+  auto max = std::optional<T>{};
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (position.is_null()) {
+      ++statistics.null_count;
+      return;
+    }
+    const auto& value = position.value();
+    if (!min || value < *min) min = value;
+    if (!max || *max < value) max = value;
+    distinct_values.insert(value);
+  });
+
+  if (min) {
+    statistics.min = *min;
+    statistics.max = *max;
+  }
+  statistics.distinct_count = distinct_values.size();
+  return statistics;
+}
+
+template <typename T>
+SegmentStatistics compute_dictionary_segment_statistics(const DictionarySegment<T>& segment) {
+  auto statistics = SegmentStatistics{};
+  const auto& attribute_vector = *segment.attribute_vector();
+  const auto null_value_id = segment.null_value_id();
+  const auto size = segment.size();
+
+  // The dictionary is sorted, so the smallest and largest used ValueID point to the minimum and maximum.
+  auto used_value_ids = std::vector<bool>(segment.unique_values_count());
+  auto value_ids = std::array<ValueID, SEGMENT_ITERATE_BLOCK_SIZE>{};
+  for (auto block_begin = ChunkOffset{0}; block_begin < size; block_begin += SEGMENT_ITERATE_BLOCK_SIZE) {
+    const auto block_end = static_cast<ChunkOffset>(std::min(size_t{size}, block_begin + SEGMENT_ITERATE_BLOCK_SIZE));
+    attribute_vector.decode(block_begin, block_end, value_ids.data());
+    for (auto index = size_t{0}; index < block_end - block_begin; ++index) {
+      const auto value_id = value_ids[index];
+      if (value_id == null_value_id) {
+        ++statistics.null_count;
+        continue;
+      }
+      used_value_ids[value_id] = true;
+    }
+  }
+
+  const auto first_used = std::find(used_value_ids.begin(), used_value_ids.end(), true);
+  if (first_used == used_value_ids.end()) return statistics;
+
+  const auto last_used = std::find(used_value_ids.rbegin(), used_value_ids.rend(), true);
+  const auto min_value_id = static_cast<ValueID::base_type>(first_used - used_value_ids.begin());
+  const auto max_value_id = static_cast<ValueID::base_type>(used_value_ids.rend() - last_used - 1);
+  statistics.min = segment.value_by_value_id(ValueID{min_value_id});
+  statistics.max = segment.value_by_value_id(ValueID{max_value_id});
+  statistics.distinct_count = static_cast<size_t>(std::count(first_used, used_value_ids.end(), true));
+  return statistics;
+}
+
+template <typename T>
+SegmentStatistics compute_run_length_segment_statistics(const RunLengthSegment<T>& segment) {
+  auto statistics = SegmentStatistics{};
+  const auto& values = segment.values();
+  const auto& null_values = segment.null_values();
+  const auto& end_positions = segment.end_positions();
+
+  auto distinct_values = std::unordered_set<T>{};
+  const T* min = nullptr;
+  const T* max = nullptr;
+  auto run_begin = ChunkOffset{0};
+  for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+    if (null_values[run_index]) {
+      statistics.null_count += end_positions[run_index] - run_begin;
+    } else {
+      const auto& value = values[run_index];
+      if (!min || value < *min) min = &value;
+      if (!max || *max < value) max = &value;
+      distinct_values.insert(value);
+    }
+    run_begin = end_positions[run_index];
+  }
+
+  if (min) {
+    statistics.min = *min;
+    statistics.max = *max;
+  }
+  statistics.distinct_count = distinct_values.size();
+  return statistics;
+}
+
+}  // namespace
+
+SegmentStatistics compute_segment_statistics(const DataType type, const BaseSegment& segment) {
+  auto statistics = SegmentStatistics{};
+  resolve_data_type(type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    resolve_segment_type<ColumnDataType>(segment, [&](const auto& typed_segment) {
+      using SegmentType = std::decay_t<decltype(typed_segment)>;
+      if constexpr (std::is_same_v<SegmentType, DictionarySegment<ColumnDataType>>) {
+        statistics = compute_dictionary_segment_statistics(typed_segment);
+      } else if constexpr (std::is_same_v<SegmentType, RunLengthSegment<ColumnDataType>>) {
+        statistics = compute_run_length_segment_statistics(typed_segment);
+      } else if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+        Fail("Statistics are not computed for ReferenceSegments.");
+      } else {
+        statistics = compute_statistics_by_value<ColumnDataType>(typed_segment);
+      }
+    });
+  });
+  return statistics;
+}
+
+}  // namespace opossum
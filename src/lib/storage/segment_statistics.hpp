@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// Statistics of a segment, which are computed when Table::compress_chunk compresses its chunk, or when a chunk that is
+// already compressed is added with Table::emplace_chunk. Chunks of ValueSegments have none. Operators use them to skip
+// chunks that cannot hold any matching row, e.g., if the search value is outside of [min, max].
+struct SegmentStatistics {
+  // the smallest and largest non-NULL value, both are NULL if the segment holds no non-NULL value
+  AllTypeVariant min;
+  AllTypeVariant max;
+
+  // the number of distinct non-NULL values
+  size_t distinct_count{0};
+
+  size_t null_count{0};
+};
+
+// the statistics of all segments of a chunk, by ColumnID
+using ChunkStatistics = std::vector<SegmentStatistics>;
+
+// Computes the statistics of a segment of the given type that is not a ReferenceSegment. For DictionarySegments, only
+// the attribute vector is scanned, as their dictionary might be shared with other segments and hold more values.
+SegmentStatistics compute_segment_statistics(const DataType type, const BaseSegment& segment);
+
+}  // namespace opossum
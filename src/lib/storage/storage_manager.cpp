@@ -1,14 +1,43 @@
 #include "storage_manager.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+namespace {
+
+std::string segment_encoding_name(const DataType column_type, const BaseSegment& segment) {
+  if (dynamic_cast<const ReferenceSegment*>(&segment)) return "Reference";
+  auto encoding_name = std::string{"Unknown"};
+  resolve_data_type(column_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    if (dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment)) {
+      encoding_name = "Value";
+    } else if (dynamic_cast<const DictionarySegment<ColumnDataType>*>(&segment)) {
+      encoding_name = "Dictionary";
+    } else if (dynamic_cast<const RunLengthSegment<ColumnDataType>*>(&segment)) {
+      encoding_name = "RunLength";
+    } else if constexpr (supports_frame_of_reference_v<ColumnDataType>) {
+      if (dynamic_cast<const FrameOfReferenceSegment<ColumnDataType>*>(&segment)) encoding_name = "FrameOfReference";
+    }
+  });
+  return encoding_name;
+}
+
+}  // namespace
+
 StorageManager& StorageManager::get() {
   static StorageManager _instance;
   return _instance;
@@ -48,6 +77,58 @@ void StorageManager::print(std::ostream& out) const {
   }
 }
 
+std::vector<SegmentMemoryUsage> StorageManager::segment_memory_usages() const {
+  auto table_names = this->table_names();
+  std::sort(table_names.begin(), table_names.end());
+
+  auto memory_usages = std::vector<SegmentMemoryUsage>{};
+  for (const auto& table_name : table_names) {
+    const auto& table = *_tables.at(table_name);
+    const auto chunk_count = table.chunk_count();
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      const auto column_type = table.column_type(column_id);
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto segment = table.get_chunk(chunk_id)->get_segment(column_id);
+        memory_usages.push_back({table_name, column_id, chunk_id, segment_encoding_name(column_type, *segment),
+                                 segment->size(), segment->estimate_memory_usage()});
+      }
+    }
+  }
+  return memory_usages;
+}
+
+void StorageManager::print_memory_usage(std::ostream& out) const {
+  const auto memory_usages = segment_memory_usages();
+  out << _tables.size() << " tables available:" << std::endl;
+
+  auto table_names = this->table_names();
+  std::sort(table_names.begin(), table_names.end());
+
+  // segment_memory_usages groups the segments by table and column. The totals are taken from the table instead of
+  // being summed up, as segments that share a dictionary each report it.
+  auto segment_iter = memory_usages.cbegin();
+  for (const auto& table_name : table_names) {
+    const auto& table = *_tables.at(table_name);
+    const auto table_end = std::find_if(segment_iter, memory_usages.cend(), [&](const auto& memory_usage) {
+      return memory_usage.table_name != table_name;
+    });
+    out << " - \"" << table_name << "\" [memory_usage=" << table.memory_usage() << "]\n";
+
+    while (segment_iter != table_end) {
+      const auto column_id = segment_iter->column_id;
+      const auto column_end = std::find_if(
+          segment_iter, table_end, [&](const auto& memory_usage) { return memory_usage.column_id != column_id; });
+      out << "   - column \"" << table.column_name(column_id) << "\" (" << table.column_type(column_id)
+          << ") [memory_usage=" << table.column_memory_usage(column_id) << "]\n";
+
+      for (; segment_iter != column_end; ++segment_iter) {
+        out << "     - chunk " << segment_iter->chunk_id << " [encoding=" << segment_iter->encoding << ","
+            << " row_count=" << segment_iter->row_count << ", memory_usage=" << segment_iter->memory_usage << "]\n";
+      }
+    }
+  }
+}
+
 void StorageManager::reset() {
   // clear all registered tables
   _tables.clear();
@@ -12,6 +12,16 @@
 
 namespace opossum {
 
+// The estimated memory usage of a single segment, as reported by StorageManager::segment_memory_usages
+struct SegmentMemoryUsage {
+  std::string table_name;
+  ColumnID column_id;
+  ChunkID chunk_id;
+  std::string encoding;
+  ChunkOffset row_count;
+  size_t memory_usage;
+};
+
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
 class StorageManager : private Noncopyable {
@@ -36,6 +46,12 @@ class StorageManager : private Noncopyable {
   // prints information about all tables in the storage manager (name, #columns, #rows, #chunks)
   void print(std::ostream& out = std::cout) const;
 
+  // returns the estimated memory usage of every segment of every table, ordered by table name, column, and chunk
+  std::vector<SegmentMemoryUsage> segment_memory_usages() const;
+
+  // prints the estimated memory usage of all tables, broken down by column and by segment
+  void print_memory_usage(std::ostream& out = std::cout) const;
+
   // deletes the entire StorageManager and creates a new one, used especially in tests
   void reset();
 
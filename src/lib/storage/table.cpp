@@ -4,20 +4,55 @@
 #include <iomanip>
 #include <limits>
 #include <memory>
+#include <memory_resource>
 #include <numeric>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "dictionary_segment.hpp"
+#include "encoding_advisor.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "global_dictionary.hpp"
+#include "reference_segment.hpp"
+#include "run_length_segment.hpp"
 #include "value_segment.hpp"
 
 #include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-Column::Column(std::string name, std::string type) : name(std::move(name)), type(std::move(type)) {}
+namespace {
+
+// Returns the estimated memory usage of a segment. Dictionaries in counted_dictionaries are skipped, as they are
+// shared with segments that were counted before, others are added to it.
+size_t segment_memory_usage(const BaseSegment& segment, const DataType data_type,
+                            std::unordered_set<const void*>& counted_dictionaries) {
+  auto memory_usage = size_t{0};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto* dictionary_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(&segment);
+    if (!dictionary_segment) {
+      memory_usage = segment.estimate_memory_usage();
+      return;
+    }
+
+    memory_usage = dictionary_segment->attribute_vector()->estimate_memory_usage();
+    if (counted_dictionaries.emplace(dictionary_segment->dictionary().get()).second) {
+      memory_usage += dictionary_segment->dictionary_memory_usage();
+    }
+  });
+  return memory_usage;
+}
+
+}  // namespace
+
+Column::Column(std::string name, const DataType type) : name(std::move(name)), type(type) {}
 
 Table::Table(const ChunkOffset target_chunk_size) : _target_chunk_size{target_chunk_size} {
   // create initial chunk
@@ -25,6 +60,10 @@ Table::Table(const ChunkOffset target_chunk_size) : _target_chunk_size{target_ch
 }
 
 void Table::add_column(const std::string& name, const std::string& type) {
+  add_column(name, data_type_from_string(type));
+}
+
+void Table::add_column(const std::string& name, const DataType type) {
   Assert(row_count() == 0, "The table already contains rows, column scheme can not be altered anymore.");
   _columns.emplace_back(name, type);
   _append_column_to_chunks(type);
@@ -33,33 +72,80 @@ void Table::add_column(const std::string& name, const std::string& type) {
 void Table::append(const std::vector<AllTypeVariant>& values) {
   if (_chunks.back()->size() == _target_chunk_size) {
     _append_new_chunk();
+  } else if (_chunks.size() == 1 && _chunks.back()->size() == 0 &&
+             _chunks.back()->capacity() < _preallocated_chunk_size()) {
+    // The storage of the initial chunk is only allocated for the first row, once the columns are known.
+    auto new_chunk = _create_chunk(_preallocated_chunk_size());
+    const auto lock = std::lock_guard<std::mutex>{_chunks_mutex};
+    _chunks.back() = std::move(new_chunk);
+    _last_chunk = _chunks.back().get();
   }
   _chunks.back()->append(values);
 }
 
-// TODO(max): write test
+void Table::append_concurrently(const std::vector<AllTypeVariant>& values) {
+  while (true) {
+    auto& last_chunk = *_last_chunk.load();
+    if (last_chunk.append_concurrently(values)) return;
+    _append_preallocated_chunk(last_chunk);
+  }
+}
+
 void Table::emplace_chunk(std::unique_ptr<Chunk> chunk) {
-  auto last_chunk = std::move(_chunks.back());
-  _chunks.pop_back();
-  if(last_chunk->size() == 0) {
-    last_chunk = std::move(chunk);
-    _chunks.emplace_back(std::move(last_chunk));
+  // Chunks that are already compressed, e.g., by a binary import, get their statistics here, as compress_chunk does
+  // not accept them. For chunks of ValueSegments, they are left to compress_chunk, so that loading is not slowed down.
+  auto is_compressed = chunk->column_count() > 0;
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    if (std::dynamic_pointer_cast<const BaseValueSegment>(chunk->get_segment(column_id))) is_compressed = false;
+  }
+  if (is_compressed && !chunk->statistics()) _compute_statistics(*chunk);
+
+  const auto lock = std::lock_guard<std::mutex>{_chunks_mutex};
+  if (_chunks.size() == 1 && _chunks.back()->size() == 0) {
+    _chunks.back() = std::move(chunk);
   } else {
-    Assert(last_chunk->size() != _target_chunk_size,
-                "Cannot emplace chunk because current last chunk is not full.");
-    _chunks.emplace_back(std::move(last_chunk));
     _chunks.emplace_back(std::move(chunk));
   }
+  _last_chunk = _chunks.back().get();
 }
 
 ColumnCount Table::column_count() const { return ColumnCount{static_cast<uint16_t>(_columns.size())}; }
 
 uint64_t Table::row_count() const {
-  return std::accumulate(_chunks.begin(), _chunks.end(), 0,
+  const auto lock = std::lock_guard<std::mutex>{_chunks_mutex};
+  return std::accumulate(_chunks.begin(), _chunks.end(), uint64_t{0},
                          [](uint64_t sum, const auto& current_chunk) { return sum + current_chunk->size(); });
 }
 
-ChunkCount Table::chunk_count() const { return ChunkCount{static_cast<uint32_t>(_chunks.size())}; }
+size_t Table::memory_usage() const {
+  const auto lock = std::lock_guard<std::mutex>{_chunks_mutex};
+  auto memory_usage = size_t{0};
+  auto counted_dictionaries = std::unordered_set<const void*>{};
+  for (const auto& chunk : _chunks) {
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      memory_usage +=
+          segment_memory_usage(*chunk->get_segment(column_id), _columns[column_id].type, counted_dictionaries);
+    }
+  }
+  return memory_usage;
+}
+
+size_t Table::column_memory_usage(const ColumnID column_id) const {
+  const auto lock = std::lock_guard<std::mutex>{_chunks_mutex};
+  auto memory_usage = size_t{0};
+  auto counted_dictionaries = std::unordered_set<const void*>{};
+  for (const auto& chunk : _chunks) {
+    if (column_id >= chunk->column_count()) continue;
+    const auto& segment = *chunk->get_segment(column_id);
+    memory_usage += segment_memory_usage(segment, _columns[column_id].type, counted_dictionaries);
+  }
+  return memory_usage;
+}
+
+ChunkCount Table::chunk_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_chunks_mutex};
+  return ChunkCount{static_cast<uint32_t>(_chunks.size())};
+}
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
   const auto find_result_iter =
@@ -84,44 +170,212 @@ const std::string& Table::column_name(const ColumnID column_id) const {
   return _columns.at(column_id).name;
 }
 
-const std::string& Table::column_type(const ColumnID column_id) const {
+DataType Table::column_type(const ColumnID column_id) const {
   return _columns.at(column_id).type;
 }
 
-Chunk& Table::get_chunk(ChunkID chunk_id) {
-  return *_chunks.at(chunk_id);
+std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) {
+  const auto lock = std::lock_guard<std::mutex>{_chunks_mutex};
+  return _chunks.at(chunk_id);
+}
+
+std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
+  const auto lock = std::lock_guard<std::mutex>{_chunks_mutex};
+  return _chunks.at(chunk_id);
 }
 
-const Chunk& Table::get_chunk(ChunkID chunk_id) const {
-  return *_chunks.at(chunk_id);
+void Table::_compute_statistics(Chunk& chunk) const {
+  const auto column_count = chunk.column_count();
+  auto statistics = std::make_shared<ChunkStatistics>();
+  statistics->reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto segment = chunk.get_segment(column_id);
+    if (std::dynamic_pointer_cast<const ReferenceSegment>(segment)) return;
+    statistics->emplace_back(compute_segment_statistics(_columns[column_id].type, *segment));
+  }
+  chunk.set_statistics(std::move(statistics));
 }
 
 void Table::_append_new_chunk() {
+  auto new_chunk = _create_chunk(_preallocated_chunk_size());
+
+  const auto lock = std::lock_guard<std::mutex>{_chunks_mutex};
+  _chunks.emplace_back(std::move(new_chunk));
+  _last_chunk = _chunks.back().get();
+}
+
+void Table::_append_preallocated_chunk(const Chunk& full_chunk) {
+  // All writers that find the last chunk full get here, but only the first one appends a new chunk. The others retry
+  // with the chunk it appended. Thus, the mutex is taken once per chunk only, not for every row.
+  const auto lock = std::lock_guard<std::mutex>{_chunks_mutex};
+  if (_last_chunk != &full_chunk) return;
+
+  auto new_chunk = _create_chunk(std::min(_target_chunk_size, MAX_PREALLOCATED_CHUNK_SIZE));
+  _last_chunk = new_chunk.get();
+
+  if (_chunks.size() == 1 && full_chunk.size() == 0) {
+    // The initial chunk, whose storage is not allocated upfront, is replaced instead of keeping an empty chunk in front
+    // of the table. Other writers might still access it, so it is kept alive.
+    _retired_chunks.emplace_back(std::move(_chunks.back()));
+    _chunks.back() = std::move(new_chunk);
+  } else {
+    _chunks.emplace_back(std::move(new_chunk));
+  }
+}
+
+ChunkOffset Table::_preallocated_chunk_size() const {
+  return _target_chunk_size <= MAX_PREALLOCATED_CHUNK_SIZE ? _target_chunk_size : ChunkOffset{0};
+}
+
+std::unique_ptr<Chunk> Table::_create_chunk(const ChunkOffset capacity) const {
   auto new_chunk = std::make_unique<Chunk>();
+  if (capacity == 0) {
+    for (const auto& column : _columns) {
+      new_chunk->add_segment(_create_value_segment_for_type(column.type));
+    }
+    return new_chunk;
+  }
 
+  // The storage of all segments is taken from a single buffer, which is allocated at once. The segments keep it
+  // alive, so it is freed together with the last of them.
+  auto buffer_size = size_t{0};
   for (const auto& column : _columns) {
-    // append existing columns as segments to new chunk
-    new_chunk->add_segment(_create_value_segment_for_type(column.type));
+    resolve_data_type(column.type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      buffer_size += capacity * sizeof(ColumnDataType) + alignof(ColumnDataType);
+      buffer_size += (capacity + 63) / 64 * sizeof(uint64_t) + alignof(uint64_t);
+    });
   }
-  _chunks.emplace_back(std::move(new_chunk));
+  const auto memory_resource = std::make_shared<std::pmr::monotonic_buffer_resource>(buffer_size);
+  for (const auto& column : _columns) {
+    new_chunk->add_segment(_create_value_segment_for_type(column.type, capacity, memory_resource));
+  }
+  return new_chunk;
 }
 
-std::shared_ptr<BaseSegment> Table::_create_value_segment_for_type(const std::string& type) {
+std::shared_ptr<BaseSegment> Table::_create_value_segment_for_type(
+    const DataType type, const ChunkOffset capacity,
+    const std::shared_ptr<std::pmr::memory_resource>& memory_resource) {
   auto new_segment = std::shared_ptr<BaseSegment>{};
   resolve_data_type(type, [&](const auto data_type_t) {
     using ColumnDataType = typename decltype(data_type_t)::type;
-    new_segment = std::make_shared<ValueSegment<ColumnDataType>>();
+    new_segment = std::make_shared<ValueSegment<ColumnDataType>>(capacity, memory_resource);
   });
   return new_segment;
 }
 
-void Table::_append_column_to_chunks(const std::string& type) {
+void Table::_append_column_to_chunks(const DataType type) {
   for (const auto& chunk : _chunks) {
-    // append new segment to every existing chunk
+    // Append a new segment to every existing chunk, which is still empty. Its storage is not allocated yet, as the
+    // rows of many tables are added by emplace_chunk(), and as the initial chunk is replaced by one whose segments
+    // share a single buffer once rows are appended.
     chunk->add_segment(_create_value_segment_for_type(type));
   }
 }
 
-void Table::compress_chunk(ChunkID chunk_id) { throw std::runtime_error("Implement Table::compress_chunk"); }
+std::shared_ptr<BaseSegment> Table::_create_encoded_segment_for_type(
+    const DataType type, const std::shared_ptr<BaseSegment>& segment, EncodingType encoding_type,
+    const std::shared_ptr<const BaseGlobalDictionary>& global_dictionary) {
+  if (global_dictionary) {
+    Assert(encoding_type == EncodingType::Automatic || encoding_type == EncodingType::Dictionary,
+           "Segments with a global dictionary have to be dictionary encoded.");
+    encoding_type = EncodingType::Dictionary;
+  } else if (encoding_type == EncodingType::Automatic) {
+    encoding_type = advise_encoding(type, *segment);
+  }
+
+  auto encoded_segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    switch (encoding_type) {
+      case EncodingType::Unencoded: {
+        const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment);
+        Assert(value_segment, "Only ValueSegments of the column type can be left unencoded.");
+        // The storage of the segment might have been allocated upfront for a full chunk, from a buffer shared by all
+        // segments of the chunk. The values are copied, so that the buffer is freed with the uncompressed chunk.
+        const auto values = value_segment->values();
+        auto null_bitmap = std::pmr::vector<uint64_t>((values.size() + 63) / 64);
+        for (auto word_index = size_t{0}; word_index < null_bitmap.size(); ++word_index) {
+          null_bitmap[word_index] = value_segment->null_bitmap_word(word_index);
+        }
+        // the bitmap can be shorter than the segment, so that segments without NULLs do not need one
+        while (!null_bitmap.empty() && null_bitmap.back() == 0) null_bitmap.pop_back();
+        null_bitmap.shrink_to_fit();
+        encoded_segment = std::make_shared<ValueSegment<ColumnDataType>>(
+            std::pmr::vector<ColumnDataType>(values.begin(), values.end()), std::move(null_bitmap));
+        return;
+      }
+      case EncodingType::Dictionary: {
+        if (!global_dictionary) {
+          encoded_segment = std::make_shared<DictionarySegment<ColumnDataType>>(segment);
+          return;
+        }
+        const auto typed_dictionary =
+            std::dynamic_pointer_cast<const GlobalDictionary<ColumnDataType>>(global_dictionary);
+        Assert(typed_dictionary, "GlobalDictionary does not match the column type.");
+        encoded_segment = std::make_shared<DictionarySegment<ColumnDataType>>(segment, typed_dictionary->values());
+        return;
+      }
+      case EncodingType::RunLength:
+        encoded_segment = std::make_shared<RunLengthSegment<ColumnDataType>>(segment);
+        return;
+      case EncodingType::FrameOfReference:
+        if constexpr (supports_frame_of_reference_v<ColumnDataType>) {
+          encoded_segment = std::make_shared<FrameOfReferenceSegment<ColumnDataType>>(segment);
+          return;
+        } else {
+          Fail("FrameOfReference encoding is only supported for int and long columns.");
+        }
+      case EncodingType::Automatic:
+        Fail("The encoding should have been chosen by now.");
+    }
+  });
+  return encoded_segment;
+}
+
+void Table::compress_chunk(ChunkID chunk_id,
+                           const std::vector<std::shared_ptr<const BaseGlobalDictionary>>& global_dictionaries) {
+  compress_chunk(chunk_id, ChunkEncodingSpec{}, global_dictionaries);
+}
+
+void Table::compress_chunk(ChunkID chunk_id, const ChunkEncodingSpec& encoding_spec,
+                           const std::vector<std::shared_ptr<const BaseGlobalDictionary>>& global_dictionaries) {
+  const auto chunk = get_chunk(chunk_id);
+  const auto column_count = chunk->column_count();
+  Assert(encoding_spec.size() <= 1 || encoding_spec.size() == column_count,
+         "Expected no, a single, or one encoding per column.");
+  Assert(global_dictionaries.empty() || global_dictionaries.size() == column_count,
+         "Expected no or one global dictionary per column.");
+
+  // Every column is compressed by its own task. Exceptions thrown while compressing a segment (e.g., because it is not
+  // a ValueSegment) are rethrown in the calling thread by the TaskScheduler.
+  auto compressed_segments = std::vector<std::shared_ptr<BaseSegment>>(column_count);
+  auto compression_jobs = std::vector<std::shared_ptr<JobTask>>{};
+  compression_jobs.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    compression_jobs.emplace_back(std::make_shared<JobTask>([&, column_id] {
+      const auto encoding_type = encoding_spec.empty()       ? EncodingType::Automatic
+                                 : encoding_spec.size() == 1 ? encoding_spec.front()
+                                                             : encoding_spec[column_id];
+      const auto global_dictionary = global_dictionaries.empty() ? nullptr : global_dictionaries[column_id];
+      compressed_segments[column_id] = _create_encoded_segment_for_type(
+          _columns[column_id].type, chunk->get_segment(column_id), encoding_type, global_dictionary);
+    }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(compression_jobs);
+
+  auto compressed_chunk = std::make_unique<Chunk>();
+  for (auto& compressed_segment : compressed_segments) {
+    compressed_chunk->add_segment(std::move(compressed_segment));
+  }
+  _compute_statistics(*compressed_chunk);
+
+  // The compressed chunk is swapped in only after all of its segments are built, so that readers either see the
+  // uncompressed or the fully compressed chunk. Readers that got the uncompressed chunk keep it alive until they are
+  // done with it.
+  const auto lock = std::lock_guard<std::mutex>{_chunks_mutex};
+  _chunks[chunk_id] = std::move(compressed_chunk);
+  _last_chunk = _chunks.back().get();
+}
 
 }  // namespace opossum
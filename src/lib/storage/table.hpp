@@ -1,8 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
 #include <string>
 #include <utility>
@@ -10,6 +12,7 @@
 
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "encoding_type.hpp"
 
 #include "type_cast.hpp"
 #include "types.hpp"
@@ -17,11 +20,12 @@
 
 namespace opossum {
 
+class BaseGlobalDictionary;
 class TableStatistics;
 struct Column {
   std::string name;
-  std::string type;
-  Column(std::string name, std::string type);
+  DataType type;
+  Column(std::string name, const DataType type);
 };
 
 // A table is partitioned horizontally into a number of chunks
@@ -43,12 +47,14 @@ class Table : private Noncopyable {
   // returns the number of chunks (cannot exceed ChunkID (uint32_t))
   ChunkCount chunk_count() const;
 
-  // returns the chunk with the given id
-  Chunk& get_chunk(ChunkID chunk_id);
-  const Chunk& get_chunk(ChunkID chunk_id) const;
+  // Returns the chunk with the given id. The chunk is kept alive by the returned pointer, even if compress_chunk
+  // replaces it in the table in the meantime.
+  std::shared_ptr<Chunk> get_chunk(ChunkID chunk_id);
+  std::shared_ptr<const Chunk> get_chunk(ChunkID chunk_id) const;
 
   // Adds a chunk to the table. If the first chunk is empty, it is replaced.
   // This method intentionally takes the unique ownership of the chunk.
+  // The statistics of compressed chunks are computed (see Chunk::statistics()).
   void emplace_chunk(std::unique_ptr<Chunk> chunk);
 
   // Returns a list of all column names.
@@ -58,7 +64,7 @@ class Table : private Noncopyable {
   const std::string& column_name(const ColumnID column_id) const;
 
   // returns the column type of the nth column
-  const std::string& column_type(const ColumnID column_id) const;
+  DataType column_type(const ColumnID column_id) const;
 
   // Returns the column with the given name.
   // This method is intended for debugging purposes only.
@@ -71,24 +77,79 @@ class Table : private Noncopyable {
   // adds a column to the end, i.e., right, of the table
   // this can only be done if the table does not yet have any entries, because we would otherwise have to deal
   // with default values
+  void add_column(const std::string& name, const DataType type);
+
+  // adds a column whose type is given by its name, e.g., "int"
   void add_column(const std::string& name, const std::string& type);
 
   // inserts a row at the end of the table
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
-  // compresses a ValueColumn into a DictionaryColumn
-  void compress_chunk(ChunkID chunk_id);
+  // Inserts a row at the end of the table. Unlike append, this can be called by multiple threads at the same time.
+  // Rows are written to chunks whose segments are allocated upfront for the target chunk size, but for at most
+  // MAX_PREALLOCATED_CHUNK_SIZE rows. Writers reserve a position in the last chunk with an atomic increment. Only
+  // the writer that finds the last chunk full first appends a new one. The values have to match the column types,
+  // as they are not converted. Mixing this with append, emplace_chunk, or compress_chunk is not supported.
+  void append_concurrently(const std::vector<AllTypeVariant>& values);
+
+  // compresses all ValueSegments of a chunk, using one task of the TaskScheduler per column
+  // the chunk is replaced as a whole once all of its segments are compressed and their statistics are computed,
+  // readers that still hold the uncompressed chunk (see get_chunk()) keep it alive
+  // encoding_spec is either empty, holds a single encoding for all columns, or one per column. Columns without an
+  // encoding or with EncodingType::Automatic are encoded as advised by advise_encoding().
+  // global_dictionaries is either empty or holds a GlobalDictionary, or nullptr, per column. The segments of columns
+  // with a GlobalDictionary are dictionary encoded with it instead of building their own dictionary (see
+  // build_global_dictionary()).
+  void compress_chunk(ChunkID chunk_id, const ChunkEncodingSpec& encoding_spec = {},
+                      const std::vector<std::shared_ptr<const BaseGlobalDictionary>>& global_dictionaries = {});
+  void compress_chunk(ChunkID chunk_id,
+                      const std::vector<std::shared_ptr<const BaseGlobalDictionary>>& global_dictionaries);
+
+  // Return the estimated number of bytes used by the segments of all chunks or of a single column. Dictionaries that
+  // several segments share, such as GlobalDictionaries, are counted once.
+  size_t memory_usage() const;
+  size_t column_memory_usage(const ColumnID column_id) const;
 
  protected:
+  // the maximum number of rows for which chunks allocate the storage of their segments upfront, which limits the
+  // memory taken by tables with a large target chunk size, such as the default one
+  static constexpr auto MAX_PREALLOCATED_CHUNK_SIZE = ChunkOffset{65'535};
+
   const uint32_t _target_chunk_size;
 
-  std::vector<std::unique_ptr<Chunk>> _chunks;
+  std::vector<std::shared_ptr<Chunk>> _chunks;
   std::vector<Column> _columns;
 
+  // guards _chunks against concurrent modification, e.g., when a compressed chunk is swapped in
+  mutable std::mutex _chunks_mutex;
+
+  // the last chunk, to which append_concurrently writes without taking _chunks_mutex
+  std::atomic<Chunk*> _last_chunk{nullptr};
+
+  // chunks that were replaced while other threads might still access them
+  std::vector<std::shared_ptr<Chunk>> _retired_chunks;
+
   // TODO(hig): If we need this more often, consider to move this to BaseSegment or ValueSegment
-  static std::shared_ptr<BaseSegment> _create_value_segment_for_type(const std::string& type);
+  static std::shared_ptr<BaseSegment> _create_value_segment_for_type(
+      const DataType type, const ChunkOffset capacity = 0,
+      const std::shared_ptr<std::pmr::memory_resource>& memory_resource = nullptr);
+  static std::shared_ptr<BaseSegment> _create_encoded_segment_for_type(
+      const DataType type, const std::shared_ptr<BaseSegment>& segment, EncodingType encoding_type,
+      const std::shared_ptr<const BaseGlobalDictionary>& global_dictionary = nullptr);
+  // Returns the number of rows for which the storage of new chunks is allocated upfront. Chunks of tables with a
+  // larger target chunk size grow on demand instead.
+  ChunkOffset _preallocated_chunk_size() const;
+
+  // creates an empty chunk with a ValueSegment for every column. If capacity is not 0, the storage of all segments is
+  // allocated upfront from a single buffer.
+  std::unique_ptr<Chunk> _create_chunk(const ChunkOffset capacity) const;
+
+  // computes the statistics of a compressed chunk, unless it consists of ReferenceSegments
+  void _compute_statistics(Chunk& chunk) const;
+
   void _append_new_chunk();
-  void _append_column_to_chunks(const std::string& type);
+  void _append_preallocated_chunk(const Chunk& full_chunk);
+  void _append_column_to_chunks(const DataType type);
 };
 }  // namespace opossum
@@ -1,5 +1,8 @@
 #include "value_segment.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -9,33 +12,151 @@
 
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
+#include "utils/size_estimation_utils.hpp"
 
 namespace opossum {
 
+template <typename T>
+ValueSegment<T>::ValueSegment(const ChunkOffset capacity, std::shared_ptr<std::pmr::memory_resource> memory_resource)
+    : _memory_resource{std::move(memory_resource)},
+      // Concurrent writers cannot grow the bitmap, so it is allocated upfront as well.
+      _null_bitmap((capacity + 63) / 64, _memory_resource ? _memory_resource.get() : std::pmr::get_default_resource()),
+      _capacity{capacity} {
+  if (capacity > 0) {
+    _preallocated_values = std::pmr::polymorphic_allocator<T>{_null_bitmap.get_allocator()}.allocate(capacity);
+  }
+}
+
+template <typename T>
+ValueSegment<T>::ValueSegment(std::pmr::vector<T>&& values, std::pmr::vector<uint64_t>&& null_bitmap)
+    : _values(std::move(values)),
+      _null_bitmap(std::move(null_bitmap)),
+      _size{static_cast<ChunkOffset>(_values.size())} {
+  DebugAssert(_null_bitmap.size() <= (_values.size() + 63) / 64, "Null bitmap is larger than the segment.");
+}
+
+template <typename T>
+ValueSegment<T>::~ValueSegment() {
+  if (!_preallocated_values) return;
+  std::destroy_n(_preallocated_values, size());
+  std::pmr::polymorphic_allocator<T>{_null_bitmap.get_allocator()}.deallocate(_preallocated_values, _capacity);
+}
+
 template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
-  return _values.at(chunk_offset);
+  Assert(chunk_offset < size(), "Position is out of range.");
+  if (is_null(chunk_offset)) return NULL_VALUE;
+  return _data()[chunk_offset];
 }
 
 template <typename T>
 void ValueSegment<T>::append(const AllTypeVariant& val) {
-  _values.emplace_back(type_cast<T>(val));
+  const auto size = _size.load(std::memory_order_relaxed);
+  const auto value = variant_is_null(val) ? T{} : type_cast<T>(val);
+  if (size < _capacity) {
+    std::construct_at(_preallocated_values + size, value);
+  } else {
+    if (_preallocated_values) _release_preallocated_values();
+    _values.emplace_back(value);
+  }
+  if (variant_is_null(val)) _set_null(size);
+  _size.store(size + 1, std::memory_order_release);
 }
 
 template <typename T>
 ChunkOffset ValueSegment<T>::size() const {
-  return _values.size();
+  return _size.load(std::memory_order_acquire);
+}
+
+template <typename T>
+std::span<const T> ValueSegment<T>::values() const {
+  return {_data(), size()};
+}
+
+template <typename T>
+bool ValueSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  return (null_bitmap_word(chunk_offset / 64) >> (chunk_offset % 64)) & 1;
 }
 
 template <typename T>
-const std::vector<T>& ValueSegment<T>::values() const {
-  return _values;
+uint64_t ValueSegment<T>::null_bitmap_word(const size_t word_index) const {
+  if (word_index >= _null_bitmap.size()) return 0;
+  // Concurrent writers may set other bits of the same word, see _set_null. std::atomic_ref requires a non-const
+  // reference, even for loads.
+  return std::atomic_ref<uint64_t>{const_cast<uint64_t&>(_null_bitmap[word_index])}.load(std::memory_order_relaxed);
 }
 
 template <typename T>
 size_t ValueSegment<T>::estimate_memory_usage() const {
-  // Implementation goes here
-  return 0;
+  const auto published_values = values();
+  // the storage allocated upfront counts as a whole, including the positions that are not written yet
+  const auto unwritten_value_count = _preallocated_values ? _capacity - published_values.size() : size_t{0};
+  return values_memory_usage(published_values) + unwritten_value_count * sizeof(T) +
+         _null_bitmap.size() * sizeof(uint64_t);
+}
+
+template <typename T>
+ChunkOffset ValueSegment<T>::capacity() const {
+  // segments without storage allocated upfront are full, as appending to them reallocates _values
+  return _preallocated_values ? _capacity : size();
+}
+
+template <typename T>
+bool ValueSegment<T>::matches_data_type(const AllTypeVariant& value) const {
+  return variant_holds<T>(value) || variant_is_null(value);
+}
+
+template <typename T>
+void ValueSegment<T>::write_reserved(const ChunkOffset chunk_offset, const AllTypeVariant& value) {
+  DebugAssert(chunk_offset < _capacity, "Position is out of the allocated range.");
+  if (variant_is_null(value)) {
+    std::construct_at(_preallocated_values + chunk_offset);
+    _set_null(chunk_offset);
+  } else {
+    std::construct_at(_preallocated_values + chunk_offset, type_cast<T>(value));
+  }
+}
+
+template <typename T>
+void ValueSegment<T>::discard_reserved(const ChunkOffset chunk_offset) {
+  DebugAssert(chunk_offset >= size() && chunk_offset < _capacity, "Position is not reserved.");
+  std::destroy_at(_preallocated_values + chunk_offset);
+  std::atomic_ref<uint64_t>{_null_bitmap[chunk_offset / 64]}.fetch_and(~(uint64_t{1} << (chunk_offset % 64)),
+                                                                       std::memory_order_relaxed);
+}
+
+template <typename T>
+void ValueSegment<T>::publish(const ChunkOffset size) {
+  DebugAssert(size <= _capacity, "Cannot publish values that have not been allocated.");
+  _size.store(size, std::memory_order_release);
+}
+
+template <typename T>
+void ValueSegment<T>::_set_null(const ChunkOffset chunk_offset) {
+  const auto word_index = chunk_offset / size_t{64};
+  if (word_index >= _null_bitmap.size()) {
+    DebugAssert(chunk_offset == _size.load(), "The null bitmap of storage allocated upfront cannot grow.");
+    _null_bitmap.resize(word_index + 1);
+  }
+  // Concurrent writers of other positions in the same word set their bits at the same time.
+  std::atomic_ref<uint64_t>{_null_bitmap[word_index]}.fetch_or(uint64_t{1} << (chunk_offset % 64),
+                                                              std::memory_order_relaxed);
+}
+
+template <typename T>
+const T* ValueSegment<T>::_data() const {
+  return _preallocated_values ? _preallocated_values : _values.data();
+}
+
+template <typename T>
+void ValueSegment<T>::_release_preallocated_values() {
+  const auto size = _size.load(std::memory_order_relaxed);
+  _values.reserve(size_t{2} * _capacity);
+  std::move(_preallocated_values, _preallocated_values + size, std::back_inserter(_values));
+  std::destroy_n(_preallocated_values, size);
+  std::pmr::polymorphic_allocator<T>{_null_bitmap.get_allocator()}.deallocate(_preallocated_values, _capacity);
+  _preallocated_values = nullptr;
+  _capacity = 0;
 }
 
 EXPLICITLY_INSTANTIATE_DATA_TYPES(ValueSegment);
@@ -1,18 +1,37 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <memory_resource>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 
-#include "base_segment.hpp"
+#include "base_value_segment.hpp"
 
 namespace opossum {
 
-// ValueSegment is a segment type that stores all its values in a vector
+// ValueSegment is a segment type that stores all its values in a vector. NULLs are marked in a separate bitmap, their
+// slot in the vector holds T{}.
 template <typename T>
-class ValueSegment : public BaseSegment {
+class ValueSegment : public BaseValueSegment {
  public:
+  ValueSegment() = default;
+
+  // Creates an empty segment whose storage for `capacity` values is allocated upfront, so that appending values does
+  // not reallocate it and values can be written concurrently (see BaseValueSegment). The storage is taken from the
+  // given memory resource, e.g., a buffer shared by all segments of a chunk, which is kept alive by the segment. The
+  // values are only constructed when they are written, so that no strings are constructed for unused positions.
+  explicit ValueSegment(const ChunkOffset capacity,
+                        std::shared_ptr<std::pmr::memory_resource> memory_resource = nullptr);
+
+  // creates a segment holding the given values, e.g., when the values of a segment are materialized at once
+  // the null bitmap has the layout described at null_bitmap_word() and may be shorter than the segment or empty
+  explicit ValueSegment(std::pmr::vector<T>&& values, std::pmr::vector<uint64_t>&& null_bitmap = {});
+
+  ~ValueSegment() override;
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
 
@@ -24,15 +43,54 @@ class ValueSegment : public BaseSegment {
 
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
-  // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
-  const std::vector<T>& values() const;
+  // e.g. const auto values = value_segment.values(); and then: values[i]; in your loop.
+  std::span<const T> values() const;
+
+  // returns whether the value at the given position is NULL
+  bool is_null(const ChunkOffset chunk_offset) const;
 
-  // returns the calculated memory usage
+  // Returns 64 entries of the null bitmap. Bit i of word w is set if the value at position 64 * w + i is NULL. Scans
+  // can combine a word with the matches of 64 values at once. Segments without storage allocated upfront allocate the
+  // bitmap only when the first NULL is appended, the words beyond the allocated bitmap are 0.
+  uint64_t null_bitmap_word(const size_t word_index) const;
+
+  // returns the calculated memory usage, including storage that was allocated upfront but is not used yet
   size_t estimate_memory_usage() const final;
 
+  ChunkOffset capacity() const final;
+
+  bool matches_data_type(const AllTypeVariant& value) const final;
+
+  void write_reserved(const ChunkOffset chunk_offset, const AllTypeVariant& value) final;
+
+  void discard_reserved(const ChunkOffset chunk_offset) final;
+
+  void publish(const ChunkOffset size) final;
+
  protected:
-  // stores the actual values
-  std::vector<T> _values;
+  // the resource _values is allocated from, if it is not the default one. It has to outlive _values.
+  std::shared_ptr<std::pmr::memory_resource> _memory_resource;
+
+  // stores the actual values if the segment has no storage allocated upfront, or once that storage is full
+  std::pmr::vector<T> _values;
+
+  // one bit per value, set for NULLs. It is taken from the same memory resource as the storage allocated upfront.
+  std::pmr::vector<uint64_t> _null_bitmap;
+
+  // storage for `_capacity` values allocated upfront, of which only the written ones are constructed
+  T* _preallocated_values{nullptr};
+  ChunkOffset _capacity{0};
+
+  // the number of published values, which are the ones visible to readers
+  std::atomic<ChunkOffset> _size{0};
+
+ private:
+  void _set_null(const ChunkOffset chunk_offset);
+
+  const T* _data() const;
+
+  // moves the values to _values and frees the storage allocated upfront, once it is full
+  void _release_preallocated_values();
 };
 
 }  // namespace opossum
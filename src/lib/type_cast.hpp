@@ -1,58 +1,109 @@
 #pragma once
 
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <limits>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
 
 #include <boost/hana/contains.hpp>
-#include <boost/hana/integral_constant.hpp>
-#include <boost/hana/not_equal.hpp>
-#include <boost/hana/size.hpp>
-#include <boost/hana/take_while.hpp>
-#include <boost/lexical_cast.hpp>
 
 #include "all_type_variant.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
-namespace hana = boost::hana;
-
-namespace detail {
-
-// Returns the index of type T in an Iterable
-template <typename Sequence, typename T>
-constexpr auto index_of(Sequence const& sequence, T const& element) {
-  constexpr auto size = decltype(hana::size(hana::take_while(sequence, hana::not_equal.to(element)))){};
-  return decltype(size)::value;
+// returns whether the variant holds a value of type T, i.e., whether it can be retrieved without conversion
+template <typename T>
+bool variant_holds(const AllTypeVariant& value) {
+  return value.index() == detail::index_of(types_including_null, hana::type_c<T>);
 }
 
-}  // namespace detail
-
 // Retrieves the value stored in an AllTypeVariant without conversion
 template <typename T>
-const T& get(const AllTypeVariant& value) {
+T get(const AllTypeVariant& value) {
   static_assert(hana::contains(types, hana::type_c<T>), "Type not in AllTypeVariant");
-  return boost::get<T>(value);
+  Assert(variant_holds<T>(value), "AllTypeVariant does not hold a value of the requested type.");
+  return value.value<T>();
 }
 
-// cast methods - from variant to specific type
+namespace detail {
 
-// Template specialization for everything but integral types
-template <typename T>
-std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (static_cast<size_t>(value.which()) == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
+// Converts a number to another numeric type. As with boost::numeric_cast, floating-point numbers are truncated towards
+// zero when converted to integers, and numbers that do not fit into the target type are rejected.
+template <typename Target, typename Source>
+Target convert_number(const Source source) {
+  if constexpr (std::is_integral_v<Target> && std::is_integral_v<Source>) {
+    Assert(std::in_range<Target>(source), "Number does not fit into the target type.");
+  } else if constexpr (std::is_integral_v<Target>) {
+    // the bounds are powers of two, so they are exact as floating-point numbers, and NaN fails both comparisons
+    constexpr auto lower_bound = static_cast<Source>(std::numeric_limits<Target>::min());
+    Assert(source >= lower_bound && source < -lower_bound, "Number does not fit into the target type.");
+  } else if constexpr (std::is_floating_point_v<Source> && sizeof(Target) < sizeof(Source)) {
+    Assert(!std::isfinite(source) || std::abs(source) <= std::numeric_limits<Target>::max(),
+           "Number does not fit into the target type.");
+  }
+  return static_cast<Target>(source);
+}
+
+// Parses a number, which has to make up the whole string. Integers may also be given as floating-point numbers, such
+// as "3.0", which are then converted by convert_number().
+template <typename Target>
+Target parse_number(std::string_view string) {
+  // unlike operator>>, from_chars does not skip a leading plus sign
+  if (string.size() > 1 && string[0] == '+' && string[1] != '-') string.remove_prefix(1);
 
-  return boost::lexical_cast<T>(value);
+  auto number = Target{};
+  const auto [end, error] = std::from_chars(string.data(), string.data() + string.size(), number);
+  if (error == std::errc{} && end == string.data() + string.size()) return number;
+
+  if constexpr (std::is_integral_v<Target>) {
+    if (error != std::errc::result_out_of_range) return convert_number<Target>(parse_number<double>(string));
+  }
+  Fail("Cannot convert \"" + std::string{string} + "\" to a number.");
 }
 
-// Template specialization for integral types
-template <typename T>
-std::enable_if_t<std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (static_cast<size_t>(value.which()) == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
+// formats a number with the fewest digits that still parse back to the same number
+template <typename Source>
+std::string format_number(const Source source) {
+  // the longest of these representations, e.g., -2.2250738585072014e-308 for doubles, have 24 characters
+  auto buffer = std::array<char, 32>{};
+  const auto end = std::to_chars(buffer.data(), buffer.data() + buffer.size(), source).ptr;
+  return std::string(buffer.data(), end);
+}
 
-  try {
-    return boost::lexical_cast<T>(value);
-  } catch (...) {
-    return boost::numeric_cast<T>(boost::lexical_cast<double>(value));
+// Converts a value of one data type to another, strings being passed as std::string_view. type_cast<Target>
+// instantiates this for every data type at compile time, so that a conversion neither formats numbers as strings nor
+// throws and catches exceptions unless strings are involved or the value does not fit.
+template <typename Target, typename Source>
+Target convert(const Source& source) {
+  if constexpr (std::is_same_v<Source, NullValue>) {
+    Fail("Cannot cast NULL.");
+  } else if constexpr (std::is_same_v<Target, std::string> && std::is_same_v<Source, std::string_view>) {
+    return std::string{source};
+  } else if constexpr (std::is_same_v<Target, std::string>) {
+    return format_number(source);
+  } else if constexpr (std::is_same_v<Source, std::string_view>) {
+    return parse_number<Target>(source);
+  } else {
+    return convert_number<Target>(source);
   }
 }
 
+}  // namespace detail
+
+// cast methods - from variant to specific type
+// NULL cannot be cast to any type, check for it with variant_is_null() first
+template <typename T>
+T type_cast(const AllTypeVariant& value) {
+  static_assert(hana::contains(types, hana::type_c<T>), "Type not in AllTypeVariant");
+  if (variant_holds<T>(value)) return value.value<T>();
+
+  return value.visit([](const auto& typed_value) { return detail::convert<T>(typed_value); });
+}
+
 }  // namespace opossum
@@ -0,0 +1,502 @@
+#include "binary_table_io.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/mapped_file.hpp"
+
+/**
+ * File layout (all integers in native byte order):
+ *
+ *   Header:   "HYRSTBL" + format version (uint8) | target chunk size (uint32) | column count (uint16)
+ *             | for each column: name, type (strings) | for each column: shared dictionaries
+ *             | chunk count (uint32) | file offset of each chunk (uint64)
+ *   Shared dictionaries: count (uint32) | for each: dictionary size (uint32) | dictionary (array)
+ *   Chunk:    row count (uint32) | for each column: segment encoding (uint8) followed by the segment
+ *   Value:    values (array of row count entries) | null bitmap word count (uint32) | null bitmap (array of uint64)
+ *   Dict:     dictionary size (uint32) | dictionary (array) | bits per value id (uint8) | attribute vector data
+ *   SharedDict: index of the shared dictionary of the column (uint32) | bits per value id (uint8)
+ *             | attribute vector data
+ *   RunLength: run count (uint32) | values (array) | NULL flags (array of uint8) | end positions (array of uint32)
+ *   FrameOfReference: block count (uint32) | block minima (array) | bits per delta (array of uint8)
+ *             | delta word count (uint32) | delta words (array of uint64) | null bitmap word count (uint32)
+ *             | null bitmap (array of uint64)
+ *
+ * Arrays of numbers are stored as they are laid out in memory, preceded by zero bytes that align them in the file to
+ * the alignment of their type. Arrays of strings are stored as the lengths of all strings (uint32 each) followed by
+ * their concatenated characters. A string is stored as its length (uint32) and its characters. Fixed-size attribute
+ * vectors are stored as their array of value ids, bit-packed ones as their 64-bit words. As the file is mapped at a
+ * page boundary, the imported attribute vectors reference these arrays in the mapping instead of copying them.
+ *
+ * Dictionaries that are used by more than one segment of a column, such as GlobalDictionaries, are stored once among
+ * the shared dictionaries of the column and restored as a single dictionary that these segments share.
+ */
+
+namespace opossum {
+
+namespace {
+
+constexpr auto MAGIC_BYTES = std::string_view{"HYRSTBL"};
+constexpr auto FORMAT_VERSION = uint8_t{4};
+
+enum class BinarySegmentEncoding : uint8_t {
+  Value = 0,
+  Dictionary = 1,
+  RunLength = 2,
+  FrameOfReference = 3,
+  SharedDictionary = 4
+};
+
+// Maps the dictionaries that are shared by several segments of a column to their index among the shared dictionaries
+using SharedDictionaryIDs = std::unordered_map<const void*, uint32_t>;
+
+class BinaryWriter {
+ public:
+  explicit BinaryWriter(const std::string& file_name) : _stream{file_name, std::ios::binary | std::ios::trunc} {
+    Assert(_stream.is_open(), "Could not open file " + file_name);
+  }
+
+  template <typename T>
+  void write(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written directly.");
+    write_bytes({reinterpret_cast<const char*>(&value), sizeof(T)});
+  }
+
+  void write(const std::string& value) {
+    write(static_cast<uint32_t>(value.size()));
+    write_bytes(value);
+  }
+
+  void write_bytes(const std::string_view bytes) {
+    _stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    _position += bytes.size();
+  }
+
+  template <typename Values>
+  void write_array(const Values& values) {
+    using T = typename Values::value_type;
+    if constexpr (std::is_same_v<T, std::string>) {
+      auto lengths = std::vector<uint32_t>{};
+      lengths.reserve(values.size());
+      for (const auto& value : values) lengths.emplace_back(static_cast<uint32_t>(value.size()));
+      write_array(lengths);
+      for (const auto& value : values) write_bytes(value);
+    } else {
+      write_padding<T>();
+      write_bytes({reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T)});
+    }
+  }
+
+  // writes zero bytes up to the alignment of T, which the reader skips before arrays of T
+  template <typename T>
+  void write_padding() {
+    static constexpr auto PADDING = std::array<char, alignof(T)>{};
+    write_bytes({PADDING.data(), (alignof(T) - _position % alignof(T)) % alignof(T)});
+  }
+
+  uint64_t position() const { return _position; }
+
+  void seek(const uint64_t position) {
+    _stream.seekp(static_cast<std::streamoff>(position));
+    _position = position;
+  }
+
+  void close() {
+    _stream.close();
+    Assert(!_stream.fail(), "Could not write binary table file.");
+  }
+
+ protected:
+  std::ofstream _stream;
+  uint64_t _position = 0;
+};
+
+class BinaryReader {
+ public:
+  explicit BinaryReader(std::shared_ptr<const MappedFile> file) : _file{std::move(file)}, _data{_file->content()} {}
+
+  template <typename T>
+  T read() {
+    auto value = T{};
+    if constexpr (std::is_same_v<T, std::string>) {
+      value = std::string{read_bytes(read<uint32_t>())};
+    } else {
+      std::memcpy(&value, read_bytes(sizeof(T)).data(), sizeof(T));
+    }
+    return value;
+  }
+
+  // Strings are constructed from the concatenated characters in a single pass. Strings longer than the capacity of the
+  // string object itself still allocate their characters one by one, as columns store std::strings.
+  template <typename T, typename Values = std::vector<T>>
+  Values read_array(const size_t size) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      const auto lengths = read_span<uint32_t>(size);
+      const auto characters = read_bytes(std::accumulate(lengths.begin(), lengths.end(), size_t{0}));
+      auto values = Values{};
+      values.reserve(size);
+      auto offset = size_t{0};
+      for (const auto length : lengths) {
+        values.emplace_back(characters.substr(offset, length));
+        offset += length;
+      }
+      return values;
+    } else {
+      const auto values = read_span<T>(size);
+      return Values(values.begin(), values.end());
+    }
+  }
+
+  // returns the next array of numbers in the file without copying it, the span is valid as long as file() lives
+  template <typename T>
+  std::span<const T> read_span(const size_t size) {
+    static_assert(std::is_arithmetic_v<T>, "Only arrays of numbers can be referenced in the file.");
+    read_bytes((alignof(T) - _position % alignof(T)) % alignof(T));
+    const auto bytes = read_bytes(size * sizeof(T));
+    Assert(reinterpret_cast<uintptr_t>(bytes.data()) % alignof(T) == 0, "Binary table file is not aligned.");
+    return {reinterpret_cast<const T*>(bytes.data()), size};
+  }
+
+  const std::shared_ptr<const MappedFile>& file() const { return _file; }
+
+  void seek(const uint64_t position) {
+    Assert(position <= _data.size(), "Binary table file is truncated.");
+    _position = position;
+  }
+
+  // returns the next bytes of the file without copying them
+  std::string_view read_bytes(const size_t size) {
+    Assert(_position + size <= _data.size(), "Binary table file is truncated.");
+    const auto bytes = _data.substr(_position, size);
+    _position += size;
+    return bytes;
+  }
+
+ protected:
+  const std::shared_ptr<const MappedFile> _file;
+  const std::string_view _data;
+  size_t _position = 0;
+};
+
+void write_attribute_vector(BinaryWriter& writer, const BaseAttributeVector& attribute_vector) {
+  if (const auto* bit_packed = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    writer.write(bit_packed->bits_per_value());
+    writer.write_array(bit_packed->words());
+  } else if (const auto* fixed_8 = dynamic_cast<const FixedSizeAttributeVector<uint8_t>*>(&attribute_vector)) {
+    writer.write(uint8_t{8});
+    writer.write_array(fixed_8->value_ids());
+  } else if (const auto* fixed_16 = dynamic_cast<const FixedSizeAttributeVector<uint16_t>*>(&attribute_vector)) {
+    writer.write(uint8_t{16});
+    writer.write_array(fixed_16->value_ids());
+  } else if (const auto* fixed_32 = dynamic_cast<const FixedSizeAttributeVector<uint32_t>*>(&attribute_vector)) {
+    writer.write(uint8_t{32});
+    writer.write_array(fixed_32->value_ids());
+  } else {
+    Fail("Unsupported attribute vector type.");
+  }
+}
+
+std::shared_ptr<BaseAttributeVector> read_attribute_vector(BinaryReader& reader, const size_t size) {
+  const auto bits_per_value = reader.read<uint8_t>();
+  switch (bits_per_value) {
+    case 1:
+    case 2:
+    case 4: {
+      const auto values_per_word = size_t{64} / bits_per_value;
+      const auto words = reader.read_span<uint64_t>((size + values_per_word - 1) / values_per_word);
+      return std::make_shared<BitPackedAttributeVector>(size, bits_per_value, words, reader.file());
+    }
+    case 8:
+      return std::make_shared<FixedSizeAttributeVector<uint8_t>>(reader.read_span<uint8_t>(size), reader.file());
+    case 16:
+      return std::make_shared<FixedSizeAttributeVector<uint16_t>>(reader.read_span<uint16_t>(size), reader.file());
+    case 32:
+      return std::make_shared<FixedSizeAttributeVector<uint32_t>>(reader.read_span<uint32_t>(size), reader.file());
+    default:
+      Fail("Unsupported attribute vector width in binary table file.");
+  }
+}
+
+// Writes the null bitmap in the layout of ValueSegment::null_bitmap_word(). Segments without NULLs get an empty bitmap.
+void write_null_bitmap(BinaryWriter& writer, const std::vector<uint64_t>& null_bitmap) {
+  const auto has_nulls = std::any_of(null_bitmap.cbegin(), null_bitmap.cend(), [](const auto word) { return word; });
+  writer.write(static_cast<uint32_t>(has_nulls ? null_bitmap.size() : 0));
+  // an empty array is written as well, as the reader skips the padding before it
+  writer.write_array(has_nulls ? null_bitmap : std::vector<uint64_t>{});
+}
+
+// Writes the dictionaries that are used by more than one DictionarySegment of a column and returns their indices
+template <typename T>
+SharedDictionaryIDs write_shared_dictionaries(BinaryWriter& writer, const Table& table, const ColumnID column_id) {
+  auto dictionaries = std::vector<std::shared_ptr<const std::vector<T>>>{};
+  auto use_counts = std::unordered_map<const void*, size_t>{};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto segment = table.get_chunk(chunk_id)->get_segment(column_id);
+    if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(segment.get())) {
+      const auto& dictionary = dictionary_segment->dictionary();
+      if (++use_counts[dictionary.get()] == 2) dictionaries.emplace_back(dictionary);
+    }
+  }
+
+  auto shared_dictionary_ids = SharedDictionaryIDs{};
+  writer.write(static_cast<uint32_t>(dictionaries.size()));
+  for (const auto& dictionary : dictionaries) {
+    shared_dictionary_ids.emplace(dictionary.get(), static_cast<uint32_t>(shared_dictionary_ids.size()));
+    writer.write(static_cast<uint32_t>(dictionary->size()));
+    writer.write_array(*dictionary);
+  }
+  return shared_dictionary_ids;
+}
+
+template <typename T>
+void write_segment(BinaryWriter& writer, const BaseSegment& segment, const SharedDictionaryIDs& shared_dictionary_ids) {
+  if constexpr (supports_frame_of_reference_v<T>) {
+    if (const auto* frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+      writer.write(BinarySegmentEncoding::FrameOfReference);
+      writer.write(static_cast<uint32_t>(frame_of_reference_segment->block_count()));
+      writer.write_array(frame_of_reference_segment->block_minima());
+      writer.write_array(frame_of_reference_segment->bits_per_delta());
+      writer.write(static_cast<uint32_t>(frame_of_reference_segment->delta_words().size()));
+      writer.write_array(frame_of_reference_segment->delta_words());
+      write_null_bitmap(writer, frame_of_reference_segment->null_bitmap());
+      return;
+    }
+  }
+
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    writer.write(BinarySegmentEncoding::Value);
+    writer.write_array(value_segment->values());
+    auto null_bitmap = std::vector<uint64_t>((segment.size() + 63) / 64);
+    for (auto word_index = size_t{0}; word_index < null_bitmap.size(); ++word_index) {
+      null_bitmap[word_index] = value_segment->null_bitmap_word(word_index);
+    }
+    write_null_bitmap(writer, null_bitmap);
+  } else if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto shared_dictionary_id = shared_dictionary_ids.find(dictionary_segment->dictionary().get());
+    if (shared_dictionary_id != shared_dictionary_ids.cend()) {
+      writer.write(BinarySegmentEncoding::SharedDictionary);
+      writer.write(shared_dictionary_id->second);
+    } else {
+      writer.write(BinarySegmentEncoding::Dictionary);
+      writer.write(static_cast<uint32_t>(dictionary_segment->unique_values_count()));
+      writer.write_array(*dictionary_segment->dictionary());
+    }
+    write_attribute_vector(writer, *dictionary_segment->attribute_vector());
+  } else if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    writer.write(BinarySegmentEncoding::RunLength);
+    writer.write(static_cast<uint32_t>(run_length_segment->values().size()));
+    writer.write_array(run_length_segment->values());
+    const auto& null_values = run_length_segment->null_values();
+    writer.write_array(std::vector<uint8_t>(null_values.cbegin(), null_values.cend()));
+    writer.write_array(run_length_segment->end_positions());
+  } else {
+    // Other segments (i.e., ReferenceSegments) are materialized.
+    auto values = std::vector<T>{};
+    values.reserve(segment.size());
+    auto null_bitmap = std::vector<uint64_t>((segment.size() + 63) / 64);
+    segment_iterate<T>(segment, [&](const auto& position) {
+      if (position.is_null()) {
+        values.emplace_back();
+        null_bitmap[position.chunk_offset() / 64] |= uint64_t{1} << (position.chunk_offset() % 64);
+      } else {
+        values.emplace_back(position.value());
+      }
+    });
+    writer.write(BinarySegmentEncoding::Value);
+    writer.write_array(values);
+    write_null_bitmap(writer, null_bitmap);
+  }
+}
+
+// Reads the shared dictionaries of a column. They are returned type-erased, so that the dictionaries of all columns can
+// be kept in one vector, and are cast back to std::vector<T> by read_segment<T>.
+template <typename T>
+std::vector<std::shared_ptr<const void>> read_shared_dictionaries(BinaryReader& reader) {
+  auto dictionaries = std::vector<std::shared_ptr<const void>>(reader.read<uint32_t>());
+  for (auto& dictionary : dictionaries) {
+    const auto dictionary_size = reader.read<uint32_t>();
+    dictionary = std::make_shared<const std::vector<T>>(reader.read_array<T>(dictionary_size));
+  }
+  return dictionaries;
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> read_segment(BinaryReader& reader, const ChunkOffset row_count,
+                                          const std::vector<std::shared_ptr<const void>>& shared_dictionaries) {
+  const auto encoding = reader.read<BinarySegmentEncoding>();
+  switch (encoding) {
+    case BinarySegmentEncoding::Value: {
+      auto values = reader.read_array<T, std::pmr::vector<T>>(row_count);
+      const auto null_bitmap_size = reader.read<uint32_t>();
+      auto null_bitmap = reader.read_array<uint64_t, std::pmr::vector<uint64_t>>(null_bitmap_size);
+      return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_bitmap));
+    }
+    case BinarySegmentEncoding::Dictionary: {
+      const auto dictionary_size = reader.read<uint32_t>();
+      auto dictionary = std::make_shared<std::vector<T>>(reader.read_array<T>(dictionary_size));
+      auto attribute_vector = read_attribute_vector(reader, row_count);
+      return std::make_shared<DictionarySegment<T>>(std::move(dictionary), std::move(attribute_vector));
+    }
+    case BinarySegmentEncoding::SharedDictionary: {
+      const auto shared_dictionary_id = reader.read<uint32_t>();
+      Assert(shared_dictionary_id < shared_dictionaries.size(), "Invalid shared dictionary in binary table file.");
+      auto dictionary = std::static_pointer_cast<const std::vector<T>>(shared_dictionaries[shared_dictionary_id]);
+      auto attribute_vector = read_attribute_vector(reader, row_count);
+      return std::make_shared<DictionarySegment<T>>(std::move(dictionary), std::move(attribute_vector));
+    }
+    case BinarySegmentEncoding::RunLength: {
+      const auto run_count = reader.read<uint32_t>();
+      auto values = reader.read_array<T>(run_count);
+      const auto null_flags = reader.read_array<uint8_t>(run_count);
+      auto end_positions = reader.read_array<ChunkOffset>(run_count);
+      Assert((end_positions.empty() ? 0 : end_positions.back()) == row_count, "Runs do not cover the chunk.");
+      return std::make_shared<RunLengthSegment<T>>(std::move(values),
+                                                   std::vector<bool>(null_flags.cbegin(), null_flags.cend()),
+                                                   std::move(end_positions));
+    }
+    case BinarySegmentEncoding::FrameOfReference: {
+      if constexpr (supports_frame_of_reference_v<T>) {
+        const auto block_count = reader.read<uint32_t>();
+        auto block_minima = reader.read_array<T>(block_count);
+        auto bits_per_delta = reader.read_array<uint8_t>(block_count);
+        auto delta_words = reader.read_array<uint64_t>(reader.read<uint32_t>());
+        auto null_bitmap = reader.read_array<uint64_t>(reader.read<uint32_t>());
+        return std::make_shared<FrameOfReferenceSegment<T>>(row_count, std::move(block_minima),
+                                                            std::move(bits_per_delta), std::move(delta_words),
+                                                            std::move(null_bitmap));
+      }
+      break;
+    }
+  }
+  Fail("Unsupported segment encoding in binary table file.");
+}
+
+}  // namespace
+
+void export_binary_table(const std::shared_ptr<const Table>& table, const std::string& file_name) {
+  // The table is written to a temporary file that replaces the file only once it is complete. Tables imported from the
+  // previous file keep referencing its mapping, which stays valid after the file is replaced.
+  const auto temporary_file_name = file_name + ".tmp";
+  auto writer = BinaryWriter{temporary_file_name};
+  writer.write_bytes(MAGIC_BYTES);
+  writer.write(FORMAT_VERSION);
+  writer.write(table->target_chunk_size());
+  writer.write(static_cast<uint16_t>(table->column_count()));
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    writer.write(table->column_name(column_id));
+    writer.write(data_type_to_string(table->column_type(column_id)));
+  }
+
+  auto shared_dictionary_ids = std::vector<SharedDictionaryIDs>{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    resolve_data_type(table->column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      shared_dictionary_ids.emplace_back(write_shared_dictionaries<ColumnDataType>(writer, *table, column_id));
+    });
+  }
+
+  const auto chunk_count = table->chunk_count();
+  writer.write(static_cast<uint32_t>(chunk_count));
+  // The chunk offsets are only known once the chunks are written, so they are filled in at the end.
+  writer.write_padding<uint64_t>();
+  const auto chunk_offsets_position = writer.position();
+  auto chunk_offsets = std::vector<uint64_t>(chunk_count);
+  writer.write_array(chunk_offsets);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunk_offsets[chunk_id] = writer.position();
+    const auto chunk = table->get_chunk(chunk_id);
+    writer.write(static_cast<uint32_t>(chunk->size()));
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      resolve_data_type(table->column_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        write_segment<ColumnDataType>(writer, *chunk->get_segment(column_id), shared_dictionary_ids[column_id]);
+      });
+    }
+  }
+
+  writer.seek(chunk_offsets_position);
+  writer.write_array(chunk_offsets);
+  writer.close();
+  std::filesystem::rename(temporary_file_name, file_name);
+}
+
+std::shared_ptr<Table> import_binary_table(const std::string& file_name) {
+  // The attribute vectors of DictionarySegments reference the mapped file, which they keep alive.
+  const auto file = std::make_shared<const MappedFile>(file_name);
+  auto reader = BinaryReader{file};
+
+  Assert(file->content().size() >= MAGIC_BYTES.size() && reader.read_bytes(MAGIC_BYTES.size()) == MAGIC_BYTES,
+         "File " + file_name + " is not a binary table file.");
+  Assert(reader.read<uint8_t>() == FORMAT_VERSION, "Unsupported binary table format version in " + file_name);
+
+  const auto target_chunk_size = reader.read<uint32_t>();
+  const auto column_count = reader.read<uint16_t>();
+  auto column_types = std::vector<DataType>{};
+  auto table = std::make_shared<Table>(target_chunk_size);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto name = reader.read<std::string>();
+    column_types.emplace_back(data_type_from_string(reader.read<std::string>()));
+    table->add_column(name, column_types.back());
+  }
+
+  auto shared_dictionaries = std::vector<std::vector<std::shared_ptr<const void>>>{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(column_types[column_id], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      shared_dictionaries.emplace_back(read_shared_dictionaries<ColumnDataType>(reader));
+    });
+  }
+
+  const auto chunk_count = ChunkCount{reader.read<uint32_t>()};
+  const auto chunk_offsets = reader.read_array<uint64_t>(chunk_count);
+
+  auto chunks = std::vector<std::unique_ptr<Chunk>>(chunk_count);
+  TaskScheduler::get().for_each_chunk(chunk_count, [&](const ChunkID chunk_id) {
+    auto chunk_reader = BinaryReader{file};
+    chunk_reader.seek(chunk_offsets[chunk_id]);
+    const auto row_count = ChunkOffset{chunk_reader.read<uint32_t>()};
+
+    auto chunk = std::make_unique<Chunk>();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(column_types[column_id], [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        chunk->add_segment(read_segment<ColumnDataType>(chunk_reader, row_count, shared_dictionaries[column_id]));
+      });
+    }
+    chunks[chunk_id] = std::move(chunk);
+  });
+
+  for (auto& chunk : chunks) {
+    table->emplace_chunk(std::move(chunk));
+  }
+  return table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+class Table;
+
+// Writes the table to a file in a native binary format. Each segment is stored in its in-memory layout: ValueSegments
+// as their raw value arrays, DictionarySegments as their dictionary followed by the packed attribute vector, and
+// RunLengthSegments and FrameOfReferenceSegments as their arrays of runs or blocks. A dictionary shared by several
+// segments of a column, e.g., a GlobalDictionary, is stored once and shared by these segments again after the import.
+// ReferenceSegments are materialized and stored like ValueSegments. Numbers are written in the byte order of the
+// machine, so the files are not meant to be moved between architectures. The file is replaced only once the table is
+// completely written, so that tables imported from the previous file stay valid.
+void export_binary_table(const std::shared_ptr<const Table>& table, const std::string& file_name);
+
+// Reads a table written by export_binary_table. The file is memory-mapped and the chunks are restored in parallel, one
+// task per chunk. The attribute vectors of DictionarySegments reference the mapped file, which they keep alive. All
+// other arrays of numbers are copied out of the mapping at once, strings are constructed one by one from their
+// concatenated characters.
+std::shared_ptr<Table> import_binary_table(const std::string& file_name);
+
+}  // namespace opossum
@@ -1,34 +1,154 @@
 #include "load_table.hpp"
 
-#include <fstream>
+#include <algorithm>
+#include <charconv>
 #include <memory>
+#include <memory_resource>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/mapped_file.hpp"
 
 namespace opossum {
 
+namespace {
+
+// Size of the parts of the file in which row boundaries are searched for in parallel
+constexpr auto ROW_BOUNDARY_SEARCH_BLOCK_SIZE = size_t{4 * 1024 * 1024};
+
+// Removes the line starting at begin from text and returns it without its line break
+std::string_view next_line(std::string_view& text) {
+  const auto line_end = std::min(text.find('\n'), text.size());
+  auto line = text.substr(0, line_end);
+  text.remove_prefix(std::min(line_end + 1, text.size()));
+  if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+  return line;
+}
+
+// Returns the (non-empty) lines of text. The text is split into blocks that are searched for line breaks in parallel.
+std::vector<std::string_view> split_lines(const std::string_view text) {
+  const auto block_count = (text.size() + ROW_BOUNDARY_SEARCH_BLOCK_SIZE - 1) / ROW_BOUNDARY_SEARCH_BLOCK_SIZE;
+  auto lines_per_block = std::vector<std::vector<std::string_view>>(block_count);
+
+  auto tasks = std::vector<std::shared_ptr<JobTask>>{};
+  tasks.reserve(block_count);
+  for (auto block_id = size_t{0}; block_id < block_count; ++block_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([&, block_id] {
+      // A block contains all lines that begin within it. Unless it is the first block, its first line begins after
+      // the first line break that precedes the block's first character.
+      auto begin = block_id * ROW_BOUNDARY_SEARCH_BLOCK_SIZE;
+      const auto end = std::min(begin + ROW_BOUNDARY_SEARCH_BLOCK_SIZE, text.size());
+      if (begin > 0) {
+        const auto line_break = text.find('\n', begin - 1);
+        begin = line_break == std::string_view::npos ? text.size() : line_break + 1;
+      }
+
+      auto& lines = lines_per_block[block_id];
+      auto remaining_text = text.substr(begin);
+      while (begin < end && !remaining_text.empty()) {
+        const auto line = next_line(remaining_text);
+        begin = text.size() - remaining_text.size();
+        if (!line.empty()) lines.emplace_back(line);
+      }
+    }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(tasks);
+
+  auto lines = std::vector<std::string_view>{};
+  for (auto& block_lines : lines_per_block) {
+    lines.insert(lines.end(), block_lines.begin(), block_lines.end());
+  }
+  return lines;
+}
+
+template <typename T>
+T parse_value(const std::string_view field) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return std::string{field};
+  } else {
+    auto value = T{};
+    const auto [end, error] = std::from_chars(field.data(), field.data() + field.size(), value);
+    if (error == std::errc{} && end == field.data() + field.size()) return value;
+
+    // Values such as "3.0" in an int column are converted the way Table::append would do it.
+    return type_cast<T>(AllTypeVariant{std::string{field}});
+  }
+}
+
+// Parses the given rows into a chunk of ValueSegments, column by column
+std::unique_ptr<Chunk> parse_chunk(const std::vector<std::string_view>& lines, const size_t begin, const size_t end,
+                                   const std::vector<DataType>& column_types) {
+  const auto column_count = column_types.size();
+  const auto row_count = end - begin;
+
+  auto fields = std::vector<std::string_view>(row_count * column_count);
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    auto line = lines[begin + row_id];
+    for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+      const auto field_end = std::min(line.find('|'), line.size());
+      Assert(column_id + 1 < column_count || field_end == line.size(),
+             "load_table: Row has more fields than the table has columns: " + std::string{lines[begin + row_id]});
+      Assert(column_id + 1 == column_count || field_end < line.size(),
+             "load_table: Row has fewer fields than the table has columns: " + std::string{lines[begin + row_id]});
+      fields[row_id * column_count + column_id] = line.substr(0, field_end);
+      line.remove_prefix(std::min(field_end + 1, line.size()));
+    }
+  }
+
+  auto chunk = std::make_unique<Chunk>();
+  for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(column_types[column_id], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      auto values = std::pmr::vector<ColumnDataType>{};
+      values.reserve(row_count);
+      for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+        values.emplace_back(parse_value<ColumnDataType>(fields[row_id * column_count + column_id]));
+      }
+      chunk->add_segment(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+    });
+  }
+  return chunk;
+}
+
+}  // namespace
+
 std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size) {
-  std::ifstream infile(file_name);
-  Assert(infile.is_open(), "load_table: Could not find file " + file_name);
+  const auto file = MappedFile{file_name};
+  auto content = file.content();
 
-  std::string line;
-  std::getline(infile, line);
-  std::vector<std::string> column_names = _split<std::string>(line, '|');
-  std::getline(infile, line);
-  std::vector<std::string> column_types = _split<std::string>(line, '|');
+  const auto column_names = _split<std::string>(std::string{next_line(content)}, '|');
+  const auto column_type_names = _split<std::string>(std::string{next_line(content)}, '|');
+  Assert(column_names.size() == column_type_names.size(), "load_table: Number of column names and types differ.");
 
-  std::shared_ptr<Table> test_table = std::make_shared<Table>(chunk_size);
+  auto column_types = std::vector<DataType>{};
+  auto table = std::make_shared<Table>(chunk_size);
   for (auto column_id = ColumnID{0}; column_id < column_names.size(); column_id++) {
-    test_table->add_column(column_names[column_id], column_types[column_id]);
+    column_types.emplace_back(data_type_from_string(column_type_names[column_id]));
+    table->add_column(column_names[column_id], column_types.back());
   }
 
-  while (std::getline(infile, line)) {
-    std::vector<AllTypeVariant> values = _split<AllTypeVariant>(line, '|');
-    test_table->append(values);
+  // Rows are parsed straight into the ValueSegments of their chunk, one task per chunk.
+  const auto lines = split_lines(content);
+  const auto chunk_count = ChunkCount{static_cast<uint32_t>((lines.size() + chunk_size - 1) / chunk_size)};
+  auto chunks = std::vector<std::unique_ptr<Chunk>>(chunk_count);
+  TaskScheduler::get().for_each_chunk(chunk_count, [&](const ChunkID chunk_id) {
+    const auto begin = chunk_id * chunk_size;
+    chunks[chunk_id] = parse_chunk(lines, begin, std::min(begin + chunk_size, lines.size()), column_types);
+  });
+
+  for (auto& chunk : chunks) {
+    table->emplace_chunk(std::move(chunk));
   }
-  return test_table;
+  return table;
 }
 
 }  // namespace opossum
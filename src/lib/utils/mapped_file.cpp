@@ -0,0 +1,42 @@
+#include "mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+#include <string_view>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MappedFile::MappedFile(const std::string& file_name) {
+  const auto file_descriptor = open(file_name.c_str(), O_RDONLY);
+  Assert(file_descriptor != -1, "Could not find file " + file_name);
+
+  struct stat file_stat {};
+  const auto stat_result = fstat(file_descriptor, &file_stat);
+  // empty files cannot be mapped, their content is an empty string
+  if (stat_result == 0 && file_stat.st_size > 0) {
+    _size = static_cast<size_t>(file_stat.st_size);
+    _data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  }
+  close(file_descriptor);
+
+  Assert(stat_result == 0, "Could not read file " + file_name);
+  Assert(_data != MAP_FAILED, "Could not map file " + file_name);
+  if (_data) madvise(_data, _size, MADV_SEQUENTIAL);
+}
+
+MappedFile::~MappedFile() {
+  if (_data) munmap(_data, _size);
+}
+
+std::string_view MappedFile::content() const {
+  if (!_data) return {};
+  return std::string_view{static_cast<const char*>(_data), _size};
+}
+
+}  // namespace opossum
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Maps a file read-only into memory for as long as the object lives
+class MappedFile : private Noncopyable {
+ public:
+  explicit MappedFile(const std::string& file_name);
+  ~MappedFile();
+
+  // returns the content of the file, which is only valid as long as the MappedFile lives
+  std::string_view content() const;
+
+ protected:
+  void* _data = nullptr;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
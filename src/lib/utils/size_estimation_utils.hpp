@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+#include <type_traits>
+
+namespace opossum {
+
+// Returns the number of bytes a string has allocated on the heap. Short strings are stored inside the string object
+// itself (small string optimization) and do not allocate any memory.
+inline size_t string_heap_size(const std::string& string) {
+  const auto* const object_begin = reinterpret_cast<const char*>(&string);
+  if (string.data() >= object_begin && string.data() < object_begin + sizeof(std::string)) return 0;
+  return string.capacity() + 1;
+}
+
+// Returns the number of bytes used by the given vector of values, including the heap payloads of strings. The unused
+// capacity of the vector is not included, as it is usually negligible and would make the estimation depend on the
+// history of the vector.
+template <typename Values>
+size_t values_memory_usage(const Values& values) {
+  using T = typename Values::value_type;
+  auto memory_usage = values.size() * sizeof(T);
+  if constexpr (std::is_same_v<T, std::string>) {
+    for (const auto& value : values) {
+      memory_usage += string_heap_size(value);
+    }
+  }
+  return memory_usage;
+}
+
+}  // namespace opossum
@@ -0,0 +1,668 @@
+#include "tpch_table_generator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "scheduler/task_scheduler.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Dates are stored as days since 1992-01-01, the first day of TPC-H. Orders are placed until 151 days before the last
+// day, so that all of their items are received by then. CURRENT_DATE (1995-06-17) decides whether items are shipped.
+constexpr auto LAST_ORDER_DATE = int32_t{2'405};
+constexpr auto CURRENT_DATE = int32_t{1'263};
+
+// the seeds of the pseudo-random sequences of the rows of each table
+enum class RowSeed : uint64_t {
+  Region = 1,
+  Nation,
+  Part,
+  PartSupp,
+  Supplier,
+  Customer,
+  Orders,
+  LineItem,
+  LineItemCount
+};
+
+// A pseudo-random number generator (splitmix64) whose sequence only depends on the table and the row it is created
+// for, so that rows can be generated in any order and by any number of threads.
+class RowRandom {
+ public:
+  RowRandom(const RowSeed seed, const uint64_t row_index) : _state{(static_cast<uint64_t>(seed) << 48) ^ row_index} {}
+
+  uint64_t next() {
+    auto value = (_state += 0x9E3779B97F4A7C15);
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+    return value ^ (value >> 31);
+  }
+
+  // returns an integer in [min, max]
+  int64_t integer(const int64_t min, const int64_t max) {
+    return min + static_cast<int64_t>(next() % static_cast<uint64_t>(max - min + 1));
+  }
+
+  // returns a decimal with two digits after the point in [min, max]
+  double decimal(const double min, const double max) {
+    return static_cast<double>(integer(std::llround(min * 100), std::llround(max * 100))) / 100;
+  }
+
+  template <typename T>
+  const T& pick(const std::vector<T>& values) {
+    return values[next() % values.size()];
+  }
+
+  // returns words of the comment vocabulary, whose length lies in [min_length, max_length]
+  std::string text(const size_t min_length, const size_t max_length);
+
+  // returns a random sequence of letters, digits, and some punctuation, of a length in [min_length, max_length]
+  std::string address(const size_t min_length, const size_t max_length);
+
+ private:
+  uint64_t _state;
+};
+
+// clang-format off
+const auto COMMENT_WORDS = std::vector<std::string>{
+    "furiously", "quickly", "carefully", "blithely", "slyly", "fluffily", "ironic", "final", "regular", "express",
+    "special", "pending", "bold", "even", "silent", "unusual", "packages", "requests", "accounts", "deposits",
+    "foxes", "ideas", "theodolites", "pinto", "beans", "instructions", "dependencies", "excuses", "platelets",
+    "asymptotes", "sleep", "wake", "are", "cajole", "haggle", "nag", "use", "boost", "affix", "detect", "integrate",
+    "about", "above", "according", "to", "across", "after", "against", "along", "among"};
+
+const auto COLORS = std::vector<std::string>{
+    "almond", "antique", "aquamarine", "azure", "beige", "bisque", "black", "blanched", "blue", "blush", "brown",
+    "burlywood", "burnished", "chartreuse", "chiffon", "chocolate", "coral", "cornflower", "cornsilk", "cream", "cyan",
+    "dark", "deep", "dim", "dodger", "drab", "firebrick", "floral", "forest", "frosted", "gainsboro", "ghost",
+    "goldenrod", "green", "grey", "honeydew", "hot", "indian", "ivory", "khaki", "lace", "lavender", "lawn", "lemon",
+    "light", "lime", "linen", "magenta", "maroon", "medium", "metallic", "midnight", "mint", "misty", "moccasin",
+    "navajo", "navy", "olive", "orange", "orchid", "pale", "papaya", "peach", "peru", "pink", "plum", "powder", "puff",
+    "purple", "red", "rose", "rosy", "royal", "saddle", "salmon", "sandy", "seashell", "sienna", "sky", "slate",
+    "smoke", "snow", "spring", "steel", "tan", "thistle", "tomato", "turquoise", "violet", "wheat", "white", "yellow"};
+
+const auto TYPE_SIZES = std::vector<std::string>{"STANDARD", "SMALL", "MEDIUM", "LARGE", "ECONOMY", "PROMO"};
+const auto TYPE_FINISHES = std::vector<std::string>{"ANODIZED", "BURNISHED", "PLATED", "POLISHED", "BRUSHED"};
+const auto TYPE_MATERIALS = std::vector<std::string>{"TIN", "NICKEL", "BRASS", "STEEL", "COPPER"};
+const auto CONTAINER_SIZES = std::vector<std::string>{"SM", "LG", "MED", "JUMBO", "WRAP"};
+const auto CONTAINER_TYPES = std::vector<std::string>{"CASE", "BOX", "BAG", "JAR", "PKG", "PACK", "CAN", "DRUM"};
+const auto MARKET_SEGMENTS = std::vector<std::string>{"AUTOMOBILE", "BUILDING", "FURNITURE", "MACHINERY", "HOUSEHOLD"};
+const auto ORDER_PRIORITIES = std::vector<std::string>{"1-URGENT", "2-HIGH", "3-MEDIUM", "4-NOT SPECIFIED", "5-LOW"};
+const auto SHIP_INSTRUCTIONS = std::vector<std::string>{"DELIVER IN PERSON", "COLLECT COD", "NONE", "TAKE BACK RETURN"};
+const auto SHIP_MODES = std::vector<std::string>{"REG AIR", "AIR", "RAIL", "SHIP", "TRUCK", "MAIL", "FOB"};
+
+const auto REGIONS = std::vector<std::string>{"AFRICA", "AMERICA", "ASIA", "EUROPE", "MIDDLE EAST"};
+
+// the nations with the keys of their regions
+const auto NATIONS = std::vector<std::pair<std::string, int32_t>>{
+    {"ALGERIA", 0}, {"ARGENTINA", 1}, {"BRAZIL", 1}, {"CANADA", 1}, {"EGYPT", 4}, {"ETHIOPIA", 0}, {"FRANCE", 3},
+    {"GERMANY", 3}, {"INDIA", 2}, {"INDONESIA", 2}, {"IRAN", 4}, {"IRAQ", 4}, {"JAPAN", 2}, {"JORDAN", 4},
+    {"KENYA", 0}, {"MOROCCO", 0}, {"MOZAMBIQUE", 0}, {"PERU", 1}, {"CHINA", 2}, {"ROMANIA", 3}, {"SAUDI ARABIA", 4},
+    {"VIETNAM", 2}, {"RUSSIA", 3}, {"UNITED KINGDOM", 3}, {"UNITED STATES", 1}};
+// clang-format on
+
+std::string RowRandom::text(const size_t min_length, const size_t max_length) {
+  const auto length = static_cast<size_t>(integer(static_cast<int64_t>(min_length), static_cast<int64_t>(max_length)));
+  auto text = std::string{};
+  while (text.size() < length) {
+    if (!text.empty()) text += ' ';
+    text += pick(COMMENT_WORDS);
+  }
+  text.resize(length);
+  return text;
+}
+
+std::string RowRandom::address(const size_t min_length, const size_t max_length) {
+  static constexpr auto CHARACTERS =
+      std::string_view{"0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ, "};
+  const auto length = static_cast<size_t>(integer(static_cast<int64_t>(min_length), static_cast<int64_t>(max_length)));
+  auto address = std::string(length, ' ');
+  for (auto& character : address) character = CHARACTERS[next() % CHARACTERS.size()];
+  return address;
+}
+
+// the number of rows of the tables that grow with the scale factor
+struct TpchScale {
+  explicit TpchScale(const float scale_factor)
+      : supplier_count{_scaled(10'000, scale_factor)},
+        part_count{_scaled(200'000, scale_factor)},
+        customer_count{_scaled(150'000, scale_factor)},
+        order_count{_scaled(1'500'000, scale_factor)} {}
+
+  const size_t supplier_count;
+  const size_t part_count;
+  const size_t customer_count;
+  const size_t order_count;
+
+ private:
+  static size_t _scaled(const size_t row_count, const float scale_factor) {
+    return std::max(size_t{1}, static_cast<size_t>(std::llround(static_cast<double>(row_count) * scale_factor)));
+  }
+};
+
+std::string format_date(const int32_t day) {
+  using namespace std::chrono;  // NOLINT
+  const auto date = year_month_day{sys_days{year{1992} / January / 1} + days{day}};
+  char buffer[16];
+  std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02u", static_cast<int>(date.year()),
+                static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()));
+  return buffer;
+}
+
+// returns the prefix followed by the number, padded with zeros to nine digits, e.g., "Supplier#000000001"
+std::string numbered_name(const std::string& prefix, const int64_t number) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%09lld", static_cast<long long>(number));  // NOLINT
+  return prefix + buffer;
+}
+
+std::string phone_number(RowRandom& random, const int32_t nation_key) {
+  char buffer[32];
+  const auto local_number = std::array<int, 3>{static_cast<int>(random.integer(100, 999)),
+                                               static_cast<int>(random.integer(100, 999)),
+                                               static_cast<int>(random.integer(1'000, 9'999))};
+  std::snprintf(buffer, sizeof(buffer), "%02d-%03d-%03d-%04d", nation_key + 10, local_number[0], local_number[1],
+                local_number[2]);
+  return buffer;
+}
+
+double retail_price(const int32_t part_key) {
+  return static_cast<double>(90'000 + (part_key / 10) % 20'001 + 100 * (part_key % 1'000)) / 100;
+}
+
+// returns the key of the index-th of the four suppliers of a part
+int32_t part_supplier_key(const TpchScale& scale, const int32_t part_key, const int32_t supplier_index) {
+  const auto supplier_count = static_cast<int64_t>(scale.supplier_count);
+  return static_cast<int32_t>(
+      (part_key + supplier_index * (supplier_count / 4 + (part_key - 1) / supplier_count)) % supplier_count + 1);
+}
+
+struct LineItem {
+  int32_t part_key;
+  int32_t supplier_key;
+  double quantity;
+  double extended_price;
+  double discount;
+  double tax;
+  int32_t ship_date;
+  int32_t commit_date;
+  int32_t receipt_date;
+  std::string return_flag;
+  std::string line_status;
+  std::string ship_instruction;
+  std::string ship_mode;
+  std::string comment;
+};
+
+struct Order {
+  int32_t key;
+  int32_t customer_key;
+  int32_t order_date;
+  std::string priority;
+  std::string clerk;
+  std::string comment;
+  std::vector<LineItem> line_items;
+};
+
+// Only the first eight of every 32 order keys are used, as in TPC-H.
+int32_t order_key(const size_t order_index) { return static_cast<int32_t>(order_index / 8 * 32 + order_index % 8 + 1); }
+
+// the number of line items of an order, which is drawn from a sequence of its own, so that the rows of lineitem can be
+// counted without generating them
+size_t line_item_count(const size_t order_index) {
+  return static_cast<size_t>(RowRandom{RowSeed::LineItemCount, order_index}.integer(1, 7));
+}
+
+Order generate_order(const TpchScale& scale, const size_t order_index) {
+  auto random = RowRandom{RowSeed::Orders, order_index};
+  auto order = Order{};
+  order.key = order_key(order_index);
+  // Every third customer does not place any orders.
+  order.customer_key = static_cast<int32_t>(random.integer(1, static_cast<int64_t>(scale.customer_count)));
+  if (order.customer_key % 3 == 0) --order.customer_key;
+  order.order_date = static_cast<int32_t>(random.integer(0, LAST_ORDER_DATE));
+  order.priority = random.pick(ORDER_PRIORITIES);
+  const auto clerk_count = std::max(int64_t{1}, static_cast<int64_t>(scale.supplier_count / 10));
+  order.clerk = numbered_name("Clerk#", random.integer(1, clerk_count));
+  order.comment = random.text(19, 78);
+
+  auto line_item_random = RowRandom{RowSeed::LineItem, order_index};
+  const auto line_count = line_item_count(order_index);
+  order.line_items.resize(line_count);
+  for (auto& line_item : order.line_items) {
+    line_item.part_key = static_cast<int32_t>(line_item_random.integer(1, static_cast<int64_t>(scale.part_count)));
+    line_item.supplier_key = part_supplier_key(scale, line_item.part_key,
+                                               static_cast<int32_t>(line_item_random.integer(0, 3)));
+    line_item.quantity = static_cast<double>(line_item_random.integer(1, 50));
+    line_item.extended_price = std::round(line_item.quantity * retail_price(line_item.part_key) * 100) / 100;
+    line_item.discount = line_item_random.decimal(0.0, 0.1);
+    line_item.tax = line_item_random.decimal(0.0, 0.08);
+    line_item.ship_date = order.order_date + static_cast<int32_t>(line_item_random.integer(1, 121));
+    line_item.commit_date = order.order_date + static_cast<int32_t>(line_item_random.integer(30, 90));
+    line_item.receipt_date = line_item.ship_date + static_cast<int32_t>(line_item_random.integer(1, 30));
+    line_item.return_flag = line_item.receipt_date <= CURRENT_DATE ? (line_item_random.integer(0, 1) ? "R" : "A") : "N";
+    line_item.line_status = line_item.ship_date > CURRENT_DATE ? "O" : "F";
+    line_item.ship_instruction = line_item_random.pick(SHIP_INSTRUCTIONS);
+    line_item.ship_mode = line_item_random.pick(SHIP_MODES);
+    line_item.comment = line_item_random.text(10, 43);
+  }
+  return order;
+}
+
+template <typename T>
+std::pmr::vector<T> reserved_values(const size_t row_count) {
+  auto values = std::pmr::vector<T>{};
+  values.reserve(row_count);
+  return values;
+}
+
+// creates a chunk with a ValueSegment per column
+template <typename... Values>
+std::unique_ptr<Chunk> make_chunk(std::pmr::vector<Values>&&... columns) {
+  auto chunk = std::make_unique<Chunk>();
+  (chunk->add_segment(std::make_shared<ValueSegment<Values>>(std::move(columns))), ...);
+  return chunk;
+}
+
+// The columns of the tables by name and type, whose order has to match the one of the segments created by make_chunk.
+using ColumnDefinitions = std::vector<std::pair<std::string, std::string>>;
+
+// generates the rows in [begin, end) of a table
+using ChunkGenerator = std::function<std::unique_ptr<Chunk>(const size_t begin, const size_t end)>;
+
+// creates a table of the given columns and fills it with chunks of chunk_size rows, one task per chunk
+std::shared_ptr<Table> generate_table(const ColumnDefinitions& column_definitions, const size_t row_count,
+                                      const ChunkOffset chunk_size, const ChunkGenerator& generate_chunk) {
+  auto table = std::make_shared<Table>(chunk_size);
+  for (const auto& [name, type] : column_definitions) {
+    table->add_column(name, type);
+  }
+
+  const auto chunk_count = ChunkCount{static_cast<uint32_t>((row_count + chunk_size - 1) / chunk_size)};
+  auto chunks = std::vector<std::unique_ptr<Chunk>>(chunk_count);
+  TaskScheduler::get().for_each_chunk(chunk_count, [&](const ChunkID chunk_id) {
+    const auto begin = size_t{chunk_id} * chunk_size;
+    chunks[chunk_id] = generate_chunk(begin, std::min(begin + chunk_size, row_count));
+  });
+
+  for (auto& chunk : chunks) {
+    table->emplace_chunk(std::move(chunk));
+  }
+  return table;
+}
+
+std::shared_ptr<Table> generate_region(const ChunkOffset chunk_size) {
+  return generate_table({{"r_regionkey", "int"}, {"r_name", "string"}, {"r_comment", "string"}}, REGIONS.size(),
+                        chunk_size, [&](const size_t begin, const size_t end) {
+                          auto keys = reserved_values<int32_t>(end - begin);
+                          auto names = reserved_values<std::string>(end - begin);
+                          auto comments = reserved_values<std::string>(end - begin);
+                          for (auto row_index = begin; row_index < end; ++row_index) {
+                            keys.emplace_back(static_cast<int32_t>(row_index));
+                            names.emplace_back(REGIONS[row_index]);
+                            comments.emplace_back(RowRandom{RowSeed::Region, row_index}.text(31, 115));
+                          }
+                          return make_chunk(std::move(keys), std::move(names), std::move(comments));
+                        });
+}
+
+std::shared_ptr<Table> generate_nation(const ChunkOffset chunk_size) {
+  return generate_table(
+      {{"n_nationkey", "int"}, {"n_name", "string"}, {"n_regionkey", "int"}, {"n_comment", "string"}}, NATIONS.size(),
+      chunk_size, [&](const size_t begin, const size_t end) {
+        auto keys = reserved_values<int32_t>(end - begin);
+        auto names = reserved_values<std::string>(end - begin);
+        auto region_keys = reserved_values<int32_t>(end - begin);
+        auto comments = reserved_values<std::string>(end - begin);
+        for (auto row_index = begin; row_index < end; ++row_index) {
+          keys.emplace_back(static_cast<int32_t>(row_index));
+          names.emplace_back(NATIONS[row_index].first);
+          region_keys.emplace_back(NATIONS[row_index].second);
+          comments.emplace_back(RowRandom{RowSeed::Nation, row_index}.text(31, 114));
+        }
+        return make_chunk(std::move(keys), std::move(names), std::move(region_keys), std::move(comments));
+      });
+}
+
+std::shared_ptr<Table> generate_supplier(const TpchScale& scale, const ChunkOffset chunk_size) {
+  return generate_table({{"s_suppkey", "int"},
+                         {"s_name", "string"},
+                         {"s_address", "string"},
+                         {"s_nationkey", "int"},
+                         {"s_phone", "string"},
+                         {"s_acctbal", "double"},
+                         {"s_comment", "string"}},
+                        scale.supplier_count, chunk_size, [&](const size_t begin, const size_t end) {
+                          auto keys = reserved_values<int32_t>(end - begin);
+                          auto names = reserved_values<std::string>(end - begin);
+                          auto addresses = reserved_values<std::string>(end - begin);
+                          auto nation_keys = reserved_values<int32_t>(end - begin);
+                          auto phones = reserved_values<std::string>(end - begin);
+                          auto account_balances = reserved_values<double>(end - begin);
+                          auto comments = reserved_values<std::string>(end - begin);
+                          for (auto row_index = begin; row_index < end; ++row_index) {
+                            auto random = RowRandom{RowSeed::Supplier, row_index};
+                            const auto key = static_cast<int32_t>(row_index + 1);
+                            const auto nation_key = static_cast<int32_t>(random.integer(0, 24));
+                            keys.emplace_back(key);
+                            names.emplace_back(numbered_name("Supplier#", key));
+                            addresses.emplace_back(random.address(10, 40));
+                            nation_keys.emplace_back(nation_key);
+                            phones.emplace_back(phone_number(random, nation_key));
+                            account_balances.emplace_back(random.decimal(-999.99, 9'999.99));
+                            comments.emplace_back(random.text(25, 100));
+                          }
+                          return make_chunk(std::move(keys), std::move(names), std::move(addresses),
+                                            std::move(nation_keys), std::move(phones), std::move(account_balances),
+                                            std::move(comments));
+                        });
+}
+
+std::shared_ptr<Table> generate_customer(const TpchScale& scale, const ChunkOffset chunk_size) {
+  return generate_table({{"c_custkey", "int"},
+                         {"c_name", "string"},
+                         {"c_address", "string"},
+                         {"c_nationkey", "int"},
+                         {"c_phone", "string"},
+                         {"c_acctbal", "double"},
+                         {"c_mktsegment", "string"},
+                         {"c_comment", "string"}},
+                        scale.customer_count, chunk_size, [&](const size_t begin, const size_t end) {
+                          auto keys = reserved_values<int32_t>(end - begin);
+                          auto names = reserved_values<std::string>(end - begin);
+                          auto addresses = reserved_values<std::string>(end - begin);
+                          auto nation_keys = reserved_values<int32_t>(end - begin);
+                          auto phones = reserved_values<std::string>(end - begin);
+                          auto account_balances = reserved_values<double>(end - begin);
+                          auto market_segments = reserved_values<std::string>(end - begin);
+                          auto comments = reserved_values<std::string>(end - begin);
+                          for (auto row_index = begin; row_index < end; ++row_index) {
+                            auto random = RowRandom{RowSeed::Customer, row_index};
+                            const auto key = static_cast<int32_t>(row_index + 1);
+                            const auto nation_key = static_cast<int32_t>(random.integer(0, 24));
+                            keys.emplace_back(key);
+                            names.emplace_back(numbered_name("Customer#", key));
+                            addresses.emplace_back(random.address(10, 40));
+                            nation_keys.emplace_back(nation_key);
+                            phones.emplace_back(phone_number(random, nation_key));
+                            account_balances.emplace_back(random.decimal(-999.99, 9'999.99));
+                            market_segments.emplace_back(random.pick(MARKET_SEGMENTS));
+                            comments.emplace_back(random.text(29, 116));
+                          }
+                          return make_chunk(std::move(keys), std::move(names), std::move(addresses),
+                                            std::move(nation_keys), std::move(phones), std::move(account_balances),
+                                            std::move(market_segments), std::move(comments));
+                        });
+}
+
+std::shared_ptr<Table> generate_part(const TpchScale& scale, const ChunkOffset chunk_size) {
+  return generate_table({{"p_partkey", "int"},
+                         {"p_name", "string"},
+                         {"p_mfgr", "string"},
+                         {"p_brand", "string"},
+                         {"p_type", "string"},
+                         {"p_size", "int"},
+                         {"p_container", "string"},
+                         {"p_retailprice", "double"},
+                         {"p_comment", "string"}},
+                        scale.part_count, chunk_size, [&](const size_t begin, const size_t end) {
+                          auto keys = reserved_values<int32_t>(end - begin);
+                          auto names = reserved_values<std::string>(end - begin);
+                          auto manufacturers = reserved_values<std::string>(end - begin);
+                          auto brands = reserved_values<std::string>(end - begin);
+                          auto types = reserved_values<std::string>(end - begin);
+                          auto sizes = reserved_values<int32_t>(end - begin);
+                          auto containers = reserved_values<std::string>(end - begin);
+                          auto retail_prices = reserved_values<double>(end - begin);
+                          auto comments = reserved_values<std::string>(end - begin);
+                          for (auto row_index = begin; row_index < end; ++row_index) {
+                            auto random = RowRandom{RowSeed::Part, row_index};
+                            const auto key = static_cast<int32_t>(row_index + 1);
+                            auto name = random.pick(COLORS);
+                            for (auto word_index = 1; word_index < 5; ++word_index) name += ' ' + random.pick(COLORS);
+                            const auto manufacturer = random.integer(1, 5);
+                            keys.emplace_back(key);
+                            names.emplace_back(std::move(name));
+                            manufacturers.emplace_back("Manufacturer#" + std::to_string(manufacturer));
+                            brands.emplace_back("Brand#" + std::to_string(manufacturer) +
+                                                std::to_string(random.integer(1, 5)));
+                            // the operands of + are evaluated in an unspecified order, so every word is drawn
+                            // by a statement of its own
+                            auto type = random.pick(TYPE_SIZES) + ' ';
+                            type += random.pick(TYPE_FINISHES) + ' ';
+                            type += random.pick(TYPE_MATERIALS);
+                            types.emplace_back(std::move(type));
+                            sizes.emplace_back(static_cast<int32_t>(random.integer(1, 50)));
+                            auto container = random.pick(CONTAINER_SIZES) + ' ';
+                            container += random.pick(CONTAINER_TYPES);
+                            containers.emplace_back(std::move(container));
+                            retail_prices.emplace_back(retail_price(key));
+                            comments.emplace_back(random.text(5, 22));
+                          }
+                          return make_chunk(std::move(keys), std::move(names), std::move(manufacturers),
+                                            std::move(brands), std::move(types), std::move(sizes),
+                                            std::move(containers), std::move(retail_prices), std::move(comments));
+                        });
+}
+
+// every part is supplied by four suppliers, whose rows follow each other
+std::shared_ptr<Table> generate_partsupp(const TpchScale& scale, const ChunkOffset chunk_size) {
+  return generate_table({{"ps_partkey", "int"},
+                         {"ps_suppkey", "int"},
+                         {"ps_availqty", "int"},
+                         {"ps_supplycost", "double"},
+                         {"ps_comment", "string"}},
+                        scale.part_count * 4, chunk_size, [&](const size_t begin, const size_t end) {
+                          auto part_keys = reserved_values<int32_t>(end - begin);
+                          auto supplier_keys = reserved_values<int32_t>(end - begin);
+                          auto available_quantities = reserved_values<int32_t>(end - begin);
+                          auto supply_costs = reserved_values<double>(end - begin);
+                          auto comments = reserved_values<std::string>(end - begin);
+                          for (auto row_index = begin; row_index < end; ++row_index) {
+                            auto random = RowRandom{RowSeed::PartSupp, row_index};
+                            const auto part_key = static_cast<int32_t>(row_index / 4 + 1);
+                            part_keys.emplace_back(part_key);
+                            supplier_keys.emplace_back(
+                                part_supplier_key(scale, part_key, static_cast<int32_t>(row_index % 4)));
+                            available_quantities.emplace_back(static_cast<int32_t>(random.integer(1, 9'999)));
+                            supply_costs.emplace_back(random.decimal(1.0, 1'000.0));
+                            comments.emplace_back(random.text(49, 198));
+                          }
+                          return make_chunk(std::move(part_keys), std::move(supplier_keys),
+                                            std::move(available_quantities), std::move(supply_costs),
+                                            std::move(comments));
+                        });
+}
+
+std::shared_ptr<Table> generate_orders(const TpchScale& scale, const ChunkOffset chunk_size) {
+  return generate_table({{"o_orderkey", "int"},
+                         {"o_custkey", "int"},
+                         {"o_orderstatus", "string"},
+                         {"o_totalprice", "double"},
+                         {"o_orderdate", "string"},
+                         {"o_orderpriority", "string"},
+                         {"o_clerk", "string"},
+                         {"o_shippriority", "int"},
+                         {"o_comment", "string"}},
+                        scale.order_count, chunk_size, [&](const size_t begin, const size_t end) {
+                          auto keys = reserved_values<int32_t>(end - begin);
+                          auto customer_keys = reserved_values<int32_t>(end - begin);
+                          auto statuses = reserved_values<std::string>(end - begin);
+                          auto total_prices = reserved_values<double>(end - begin);
+                          auto order_dates = reserved_values<std::string>(end - begin);
+                          auto priorities = reserved_values<std::string>(end - begin);
+                          auto clerks = reserved_values<std::string>(end - begin);
+                          auto ship_priorities = reserved_values<int32_t>(end - begin);
+                          auto comments = reserved_values<std::string>(end - begin);
+                          for (auto row_index = begin; row_index < end; ++row_index) {
+                            auto order = generate_order(scale, row_index);
+                            // The status is F or O if all line items have this status, and P otherwise.
+                            auto total_price = 0.0;
+                            auto shipped_count = size_t{0};
+                            for (const auto& line_item : order.line_items) {
+                              total_price += line_item.extended_price * (1 + line_item.tax) * (1 - line_item.discount);
+                              if (line_item.line_status == "F") ++shipped_count;
+                            }
+                            const auto status = shipped_count == order.line_items.size() ? "F"
+                                                : shipped_count == 0                     ? "O"
+                                                                                         : "P";
+                            keys.emplace_back(order.key);
+                            customer_keys.emplace_back(order.customer_key);
+                            statuses.emplace_back(status);
+                            total_prices.emplace_back(std::round(total_price * 100) / 100);
+                            order_dates.emplace_back(format_date(order.order_date));
+                            priorities.emplace_back(std::move(order.priority));
+                            clerks.emplace_back(std::move(order.clerk));
+                            ship_priorities.emplace_back(0);
+                            comments.emplace_back(std::move(order.comment));
+                          }
+                          return make_chunk(std::move(keys), std::move(customer_keys), std::move(statuses),
+                                            std::move(total_prices), std::move(order_dates), std::move(priorities),
+                                            std::move(clerks), std::move(ship_priorities), std::move(comments));
+                        });
+}
+
+// The line items of an order follow each other. To find the first order of a chunk, the line items are counted per
+// group of orders upfront.
+std::shared_ptr<Table> generate_lineitem(const TpchScale& scale, const ChunkOffset chunk_size) {
+  const auto order_group_size = size_t{chunk_size};
+  const auto order_group_count = (scale.order_count + order_group_size - 1) / order_group_size;
+  auto group_line_item_offsets = std::vector<size_t>(order_group_count + 1);
+  TaskScheduler::get().for_each_chunk(
+      ChunkCount{static_cast<uint32_t>(order_group_count)}, [&](const ChunkID group_id) {
+        const auto group_end = std::min((size_t{group_id} + 1) * order_group_size, scale.order_count);
+        for (auto order_index = size_t{group_id} * order_group_size; order_index < group_end; ++order_index) {
+          group_line_item_offsets[group_id + 1] += line_item_count(order_index);
+        }
+      });
+  for (auto group_id = size_t{0}; group_id < order_group_count; ++group_id) {
+    group_line_item_offsets[group_id + 1] += group_line_item_offsets[group_id];
+  }
+
+  return generate_table(
+      {{"l_orderkey", "int"},
+       {"l_partkey", "int"},
+       {"l_suppkey", "int"},
+       {"l_linenumber", "int"},
+       {"l_quantity", "double"},
+       {"l_extendedprice", "double"},
+       {"l_discount", "double"},
+       {"l_tax", "double"},
+       {"l_returnflag", "string"},
+       {"l_linestatus", "string"},
+       {"l_shipdate", "string"},
+       {"l_commitdate", "string"},
+       {"l_receiptdate", "string"},
+       {"l_shipinstruct", "string"},
+       {"l_shipmode", "string"},
+       {"l_comment", "string"}},
+      group_line_item_offsets.back(), chunk_size, [&](const size_t begin, const size_t end) {
+        auto order_keys = reserved_values<int32_t>(end - begin);
+        auto part_keys = reserved_values<int32_t>(end - begin);
+        auto supplier_keys = reserved_values<int32_t>(end - begin);
+        auto line_numbers = reserved_values<int32_t>(end - begin);
+        auto quantities = reserved_values<double>(end - begin);
+        auto extended_prices = reserved_values<double>(end - begin);
+        auto discounts = reserved_values<double>(end - begin);
+        auto taxes = reserved_values<double>(end - begin);
+        auto return_flags = reserved_values<std::string>(end - begin);
+        auto line_statuses = reserved_values<std::string>(end - begin);
+        auto ship_dates = reserved_values<std::string>(end - begin);
+        auto commit_dates = reserved_values<std::string>(end - begin);
+        auto receipt_dates = reserved_values<std::string>(end - begin);
+        auto ship_instructions = reserved_values<std::string>(end - begin);
+        auto ship_modes = reserved_values<std::string>(end - begin);
+        auto comments = reserved_values<std::string>(end - begin);
+
+        // skip the orders of the group whose line items all precede the chunk
+        const auto group_id = static_cast<size_t>(
+            std::upper_bound(group_line_item_offsets.begin(), group_line_item_offsets.end(), begin) -
+            group_line_item_offsets.begin() - 1);
+        auto order_index = group_id * order_group_size;
+        auto row_index = group_line_item_offsets[group_id];
+        while (row_index + line_item_count(order_index) <= begin) {
+          row_index += line_item_count(order_index);
+          ++order_index;
+        }
+
+        while (row_index < end) {
+          auto order = generate_order(scale, order_index);
+          for (auto line_index = size_t{0}; line_index < order.line_items.size(); ++line_index, ++row_index) {
+            if (row_index < begin) continue;
+            if (row_index == end) break;
+            auto& line_item = order.line_items[line_index];
+            order_keys.emplace_back(order.key);
+            part_keys.emplace_back(line_item.part_key);
+            supplier_keys.emplace_back(line_item.supplier_key);
+            line_numbers.emplace_back(static_cast<int32_t>(line_index + 1));
+            quantities.emplace_back(line_item.quantity);
+            extended_prices.emplace_back(line_item.extended_price);
+            discounts.emplace_back(line_item.discount);
+            taxes.emplace_back(line_item.tax);
+            return_flags.emplace_back(std::move(line_item.return_flag));
+            line_statuses.emplace_back(std::move(line_item.line_status));
+            ship_dates.emplace_back(format_date(line_item.ship_date));
+            commit_dates.emplace_back(format_date(line_item.commit_date));
+            receipt_dates.emplace_back(format_date(line_item.receipt_date));
+            ship_instructions.emplace_back(std::move(line_item.ship_instruction));
+            ship_modes.emplace_back(std::move(line_item.ship_mode));
+            comments.emplace_back(std::move(line_item.comment));
+          }
+          ++order_index;
+        }
+        return make_chunk(std::move(order_keys), std::move(part_keys), std::move(supplier_keys),
+                          std::move(line_numbers), std::move(quantities), std::move(extended_prices),
+                          std::move(discounts), std::move(taxes), std::move(return_flags), std::move(line_statuses),
+                          std::move(ship_dates), std::move(commit_dates), std::move(receipt_dates),
+                          std::move(ship_instructions), std::move(ship_modes), std::move(comments));
+      });
+}
+
+}  // namespace
+
+const std::vector<std::string>& tpch_table_names() {
+  static const auto table_names = std::vector<std::string>{"region",   "nation", "supplier", "customer",
+                                                           "part",     "partsupp", "orders", "lineitem"};
+  return table_names;
+}
+
+std::shared_ptr<Table> generate_tpch_table(const std::string& table_name, const float scale_factor,
+                                           const ChunkOffset chunk_size) {
+  Assert(scale_factor > 0, "The scale factor has to be positive.");
+  Assert(chunk_size > 0, "The chunk size has to be positive.");
+  const auto scale = TpchScale{scale_factor};
+  if (table_name == "region") return generate_region(chunk_size);
+  if (table_name == "nation") return generate_nation(chunk_size);
+  if (table_name == "supplier") return generate_supplier(scale, chunk_size);
+  if (table_name == "customer") return generate_customer(scale, chunk_size);
+  if (table_name == "part") return generate_part(scale, chunk_size);
+  if (table_name == "partsupp") return generate_partsupp(scale, chunk_size);
+  if (table_name == "orders") return generate_orders(scale, chunk_size);
+  if (table_name == "lineitem") return generate_lineitem(scale, chunk_size);
+  Fail("Unknown TPC-H table: " + table_name);
+}
+
+void generate_tpch_tables(const float scale_factor, const ChunkOffset chunk_size) {
+  for (const auto& table_name : tpch_table_names()) {
+    StorageManager::get().add_table(table_name, generate_tpch_table(table_name, scale_factor, chunk_size));
+  }
+}
+
+}  // namespace opossum
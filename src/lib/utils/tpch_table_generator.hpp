@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// the chunk size of generated tables, unless another one is given
+constexpr auto DEFAULT_TPCH_CHUNK_SIZE = ChunkOffset{100'000};
+
+// the names of the TPC-H tables in the order in which generate_tpch_tables() generates them
+const std::vector<std::string>& tpch_table_names();
+
+// Generates a table with the schema and the value distributions of the TPC-H table of the given name. The number of
+// rows scales with scale_factor as defined by TPC-H, e.g., orders holds 1'500'000 rows at scale factor 1, but nation
+// and region are of fixed size. The generator is a simplified version of dbgen: Comments are sequences of random words,
+// decimals are doubles, and dates are strings in ISO format.
+//
+// Every row is generated from a pseudo-random sequence that only depends on the table and the position of the row, so
+// the tables are the same for every run, chunk size, and number of threads. Chunks are generated as one task each and
+// added to the table with emplace_chunk(). Foreign keys only reference existing rows and o_totalprice, o_orderstatus,
+// and the dates of lineitem are consistent with each other as in TPC-H.
+std::shared_ptr<Table> generate_tpch_table(const std::string& table_name, const float scale_factor,
+                                           const ChunkOffset chunk_size = DEFAULT_TPCH_CHUNK_SIZE);
+
+// generates all TPC-H tables at the given scale factor and adds them to the StorageManager under their names
+void generate_tpch_tables(const float scale_factor, const ChunkOffset chunk_size = DEFAULT_TPCH_CHUNK_SIZE);
+
+}  // namespace opossum
@@ -6,12 +6,31 @@
 #include <utility>
 #include <vector>
 
+#include "resolve_type.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "type_cast.hpp"
 
 namespace opossum {
 
+namespace {
+
+// Comparisons with NULL are always false, so operator< is no strict weak ordering on rows with NULLs. Rows are
+// therefore sorted with this total order, which puts NULLs before all values.
+bool row_less(const std::vector<AllTypeVariant>& left, const std::vector<AllTypeVariant>& right) {
+  return std::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end(),
+                                      [](const AllTypeVariant& left_value, const AllTypeVariant& right_value) {
+                                        if (variant_is_null(left_value) || variant_is_null(right_value)) {
+                                          return variant_is_null(left_value) && !variant_is_null(right_value);
+                                        }
+                                        return left_value < right_value;
+                                      });
+}
+
+}  // namespace
+
 void BaseTest::EXPECT_TABLE_EQ(const Table& tleft, const Table& tright, bool order_sensitive, bool strict_types) {
   EXPECT_TRUE(_table_equal(tleft, tright, order_sensitive, strict_types));
 }
@@ -37,19 +56,23 @@ BaseTest::Matrix BaseTest::_table_to_matrix(const Table& table) {
   // set values
   unsigned row_offset = 0;
   for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
-    const Chunk& chunk = table.get_chunk(chunk_id);
+    const auto chunk = table.get_chunk(chunk_id);
 
     // an empty table's chunk might be missing actual segments
-    if (chunk.size() == 0) continue;
+    if (chunk->size() == 0) continue;
 
     for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
-      std::shared_ptr<BaseSegment> segment = chunk.get_segment(column_id);
-
-      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
-        matrix[row_offset + chunk_offset][column_id] = (*segment)[chunk_offset];
-      }
+      std::shared_ptr<BaseSegment> segment = chunk->get_segment(column_id);
+
+      resolve_data_type(table.column_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+          auto& cell = matrix[row_offset + position.chunk_offset()][column_id];
+          cell = position.is_null() ? NULL_VALUE : AllTypeVariant{position.value()};
+        });
+      });
     }
-    row_offset += chunk.size();
+    row_offset += chunk->size();
   }
 
   return matrix;
@@ -79,22 +102,22 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& matrix) {
   }
 
   //  - column names and types
-  std::string left_data_type, right_data_type;
+  DataType left_data_type, right_data_type;
   for (ColumnID column_id{0}; column_id < tright.column_count(); ++column_id) {
     left_data_type = tleft.column_type(column_id);
     right_data_type = tright.column_type(column_id);
     // This is needed for the SQLiteTestrunner, since SQLite does not differentiate between float/double, and int/long.
     if (!strict_types) {
-      if (left_data_type == "double") {
-        left_data_type = "float";
-      } else if (left_data_type == "long") {
-        left_data_type = "int";
+      if (left_data_type == DataType::Double) {
+        left_data_type = DataType::Float;
+      } else if (left_data_type == DataType::Long) {
+        left_data_type = DataType::Int;
       }
 
-      if (right_data_type == "double") {
-        right_data_type = "float";
-      } else if (right_data_type == "long") {
-        right_data_type = "int";
+      if (right_data_type == DataType::Double) {
+        right_data_type = DataType::Float;
+      } else if (right_data_type == DataType::Long) {
+        right_data_type = DataType::Int;
       }
     }
     if (left_data_type != right_data_type || tleft.column_name(column_id) != tright.column_name(column_id)) {
@@ -118,34 +141,41 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& matrix) {
 
   // sort if order does not matter
   if (!order_sensitive) {
-    std::sort(left.begin(), left.end());
-    std::sort(right.begin(), right.end());
+    std::sort(left.begin(), left.end(), row_less);
+    std::sort(right.begin(), right.end(), row_less);
   }
 
   for (unsigned row = 0; row < left.size(); row++)
     for (ColumnID column_id{0}; column_id < left[row].size(); column_id++) {
-      if (tleft.column_type(column_id) == "float") {
+      // NULLs are not equal to anything, not even to NULL, so they are compared separately
+      if (variant_is_null(left[row][column_id]) || variant_is_null(right[row][column_id])) {
+        EXPECT_TRUE(variant_is_null(left[row][column_id]) && variant_is_null(right[row][column_id]))
+            << "Row:" << row + 1 << " Column:" << column_id + 1;
+      } else if (tleft.column_type(column_id) == DataType::Float) {
         auto left_val = type_cast<float>(left[row][column_id]);
         auto right_val = type_cast<float>(right[row][column_id]);
 
         if (strict_types) {
-          EXPECT_EQ(tright.column_type(column_id), "float");
+          EXPECT_EQ(tright.column_type(column_id), DataType::Float);
         } else {
-          EXPECT_TRUE(tright.column_type(column_id) == "float" || tright.column_type(column_id) == "double");
+          EXPECT_TRUE(tright.column_type(column_id) == DataType::Float ||
+                      tright.column_type(column_id) == DataType::Double);
         }
         EXPECT_NEAR(left_val, right_val, 0.0001) << "Row/Column:" << row << "/" << column_id;
-      } else if (tleft.column_type(column_id) == "double") {
+      } else if (tleft.column_type(column_id) == DataType::Double) {
         auto left_val = type_cast<double>(left[row][column_id]);
         auto right_val = type_cast<double>(right[row][column_id]);
 
         if (strict_types) {
-          EXPECT_EQ(tright.column_type(column_id), "double");
+          EXPECT_EQ(tright.column_type(column_id), DataType::Double);
         } else {
-          EXPECT_TRUE(tright.column_type(column_id) == "float" || tright.column_type(column_id) == "double");
+          EXPECT_TRUE(tright.column_type(column_id) == DataType::Float ||
+                      tright.column_type(column_id) == DataType::Double);
         }
         EXPECT_NEAR(left_val, right_val, 0.0001) << "Row/Column:" << row << "/" << column_id;
       } else {
-        if (!strict_types && (tleft.column_type(column_id) == "int" || tleft.column_type(column_id) == "long")) {
+        if (!strict_types &&
+            (tleft.column_type(column_id) == DataType::Int || tleft.column_type(column_id) == DataType::Long)) {
           auto left_val = type_cast<int64_t>(left[row][column_id]);
           auto right_val = type_cast<int64_t>(right[row][column_id]);
           EXPECT_EQ(left_val, right_val) << "Row:" << row + 1 << " Column_id:" << column_id + 1;
@@ -158,6 +188,10 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& matrix) {
   return ::testing::AssertionSuccess();
 }
 
-BaseTest::~BaseTest() { StorageManager::get().reset(); }
+BaseTest::~BaseTest() {
+  // a test that fails while the scheduler is active must not leave it running for the next test
+  if (TaskScheduler::get().is_active()) TaskScheduler::get().finish();
+  StorageManager::get().reset();
+}
 
 }  // namespace opossum
@@ -1,10 +1,19 @@
+#include <cmath>
 #include <cstdlib>
+#include <limits>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
-#include <boost/variant.hpp>
+#include <boost/hana/for_each.hpp>
 
 #include "base_test.hpp"
 
+#include "resolve_type.hpp"
+
+#include "type_cast.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -31,10 +40,183 @@ TYPED_TEST(AllTypeVariantTest, GetExtractsExactNumericalValue) {
 
   for (auto value_in : values) {
     const auto variant = AllTypeVariant{value_in};
-    const auto value_out = boost::get<TypeParam>(variant);
+    const auto value_out = get<TypeParam>(variant);
 
     ASSERT_EQ(value_in, value_out);
   }
 }
 
+TYPED_TEST(AllTypeVariantTest, Nulls) {
+  EXPECT_TRUE(variant_is_null(AllTypeVariant{}));
+  EXPECT_TRUE(variant_is_null(NULL_VALUE));
+  EXPECT_FALSE(variant_is_null(AllTypeVariant{TypeParam{}}));
+  EXPECT_FALSE(variant_holds<TypeParam>(NULL_VALUE));
+  EXPECT_TRUE(variant_holds<TypeParam>(AllTypeVariant{TypeParam{}}));
+  EXPECT_THROW(type_cast<TypeParam>(NULL_VALUE), std::exception);
+
+  // as in SQL, NULL is not equal to NULL
+  EXPECT_FALSE(NULL_VALUE == NULL_VALUE);
+}
+
+TYPED_TEST(AllTypeVariantTest, CopyAndMove) {
+  auto values = std::vector<TypeParam>{TypeParam{}};
+  if constexpr (std::is_same_v<TypeParam, std::string>) {
+    values.emplace_back(AllTypeVariant::SHORT_STRING_CAPACITY, 's');
+    values.emplace_back(AllTypeVariant::SHORT_STRING_CAPACITY + 1, 'l');
+  } else {
+    values.emplace_back(std::numeric_limits<TypeParam>::max());
+  }
+
+  for (const auto& value : values) {
+    const auto variant = AllTypeVariant{value};
+    auto copy = variant;
+    EXPECT_EQ(get<TypeParam>(copy), value);
+    copy = AllTypeVariant{TypeParam{}};
+    copy = variant;
+    EXPECT_EQ(get<TypeParam>(copy), value);
+
+    auto moved = std::move(copy);
+    EXPECT_EQ(get<TypeParam>(moved), value);
+    copy = std::move(moved);
+    EXPECT_EQ(get<TypeParam>(copy), value);
+    EXPECT_EQ(get<TypeParam>(variant), value);
+  }
+}
+
+TYPED_TEST(AllTypeVariantTest, TypeCastFromAllTypes) {
+  // every data type can be converted to every other one as long as the value fits
+  for (const auto& variant : {AllTypeVariant{int32_t{17}}, AllTypeVariant{int64_t{17}}, AllTypeVariant{17.0f},
+                              AllTypeVariant{17.0}, AllTypeVariant{"17"}}) {
+    if constexpr (std::is_same_v<TypeParam, std::string>) {
+      EXPECT_EQ(type_cast<TypeParam>(variant), "17");
+    } else {
+      EXPECT_EQ(type_cast<TypeParam>(variant), TypeParam{17});
+    }
+  }
+}
+
+TEST(AllTypeVariantTest, TypeCastNumbers) {
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{std::numeric_limits<int32_t>::min()}),
+            int64_t{std::numeric_limits<int32_t>::min()});
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{int64_t{-5}}), -5);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{int64_t{1} << 31}), std::exception);
+
+  // floating-point numbers are truncated towards zero
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{3.9}), 3);
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{-3.9f}), -3);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{-2147483648.0}), std::numeric_limits<int32_t>::min());
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{2147483648.0}), std::exception);
+  EXPECT_THROW(type_cast<int64_t>(AllTypeVariant{1e19f}), std::exception);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{std::numeric_limits<double>::quiet_NaN()}), std::exception);
+
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{0.1f}), static_cast<double>(0.1f));
+  EXPECT_EQ(type_cast<float>(AllTypeVariant{0.1}), 0.1f);
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{int64_t{1} << 53}), 9007199254740992.0);
+  EXPECT_TRUE(std::isinf(type_cast<float>(AllTypeVariant{std::numeric_limits<double>::infinity()})));
+  EXPECT_THROW(type_cast<float>(AllTypeVariant{1e300}), std::exception);
+}
+
+TEST(AllTypeVariantTest, TypeCastStrings) {
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"-42"}), -42);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"+42"}), 42);
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{"9223372036854775807"}), std::numeric_limits<int64_t>::max());
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"3.0"}), 3);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"1e3"}), 1'000);
+  EXPECT_EQ(type_cast<float>(AllTypeVariant{"0.25"}), 0.25f);
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{"-1.5e-3"}), -1.5e-3);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{"2147483648"}), std::exception);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{"12abc"}), std::exception);
+  EXPECT_THROW(type_cast<double>(AllTypeVariant{" 1"}), std::exception);
+  EXPECT_THROW(type_cast<double>(AllTypeVariant{""}), std::exception);
+  EXPECT_THROW(type_cast<float>(AllTypeVariant{"1e39"}), std::exception);
+
+  // numbers are formatted with as few digits as needed to parse them back
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{std::numeric_limits<int64_t>::min()}), "-9223372036854775808");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{0.1f}), "0.1");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{0.1}), "0.1");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{-1.25}), "-1.25");
+  const auto doubles = {1.0 / 3.0, std::numeric_limits<double>::lowest(), std::numeric_limits<double>::denorm_min()};
+  for (const auto value : doubles) {
+    EXPECT_EQ(type_cast<double>(AllTypeVariant{type_cast<std::string>(AllTypeVariant{value})}), value);
+  }
+}
+
+TEST(AllTypeVariantTest, CompactRepresentation) {
+  EXPECT_EQ(sizeof(AllTypeVariant), 16u);
+
+  // strings are stored inline up to SHORT_STRING_CAPACITY characters, and on the heap otherwise
+  const auto short_string = std::string(AllTypeVariant::SHORT_STRING_CAPACITY, 'a');
+  const auto long_string = short_string + "bc";
+  EXPECT_EQ(get<std::string>(AllTypeVariant{short_string}), short_string);
+  EXPECT_EQ(get<std::string>(AllTypeVariant{long_string}), long_string);
+  EXPECT_EQ(get<std::string>(AllTypeVariant{"with\0nul"}), "with\0nul");
+  EXPECT_EQ(get<std::string>(AllTypeVariant{std::string_view{"view"}}), "view");
+  EXPECT_THROW(get<int32_t>(AllTypeVariant{int64_t{1}}), std::exception);
+}
+
+TEST(AllTypeVariantTest, Comparisons) {
+  EXPECT_EQ(AllTypeVariant{"abc"}, AllTypeVariant{std::string{"abc"}});
+  EXPECT_NE(AllTypeVariant{"abc"}, AllTypeVariant{"abd"});
+  EXPECT_LT(AllTypeVariant{"abc"}, AllTypeVariant{"abd"});
+  EXPECT_LT(AllTypeVariant{std::string(20, 'a')}, AllTypeVariant{"b"});
+  EXPECT_GT(AllTypeVariant{2.5}, AllTypeVariant{-2.5});
+  EXPECT_LE(AllTypeVariant{3}, AllTypeVariant{3});
+
+  // values of different types are never equal and are ordered by their type
+  EXPECT_NE(AllTypeVariant{1}, AllTypeVariant{int64_t{1}});
+  EXPECT_LT(AllTypeVariant{100}, AllTypeVariant{int64_t{1}});
+  EXPECT_LT(AllTypeVariant{1.0}, AllTypeVariant{"0"});
+  EXPECT_GE(AllTypeVariant{"0"}, AllTypeVariant{1.0});
+}
+
+TEST(AllTypeVariantTest, ComparisonsWithNull) {
+  // as in SQL, comparisons with NULL are never true, not even the negated ones
+  for (const auto& value : {NULL_VALUE, AllTypeVariant{0}, AllTypeVariant{"a"}}) {
+    EXPECT_FALSE(NULL_VALUE == value);
+    EXPECT_FALSE(NULL_VALUE != value);
+    EXPECT_FALSE(NULL_VALUE < value);
+    EXPECT_FALSE(NULL_VALUE <= value);
+    EXPECT_FALSE(NULL_VALUE > value);
+    EXPECT_FALSE(NULL_VALUE >= value);
+    EXPECT_FALSE(value == NULL_VALUE);
+    EXPECT_FALSE(value != NULL_VALUE);
+    EXPECT_FALSE(value < NULL_VALUE);
+    EXPECT_FALSE(value <= NULL_VALUE);
+    EXPECT_FALSE(value > NULL_VALUE);
+    EXPECT_FALSE(value >= NULL_VALUE);
+  }
+}
+
+TEST(AllTypeVariantTest, Print) {
+  auto stream = std::stringstream{};
+  stream << AllTypeVariant{17} << ' ' << AllTypeVariant{int64_t{-3}} << ' ' << AllTypeVariant{0.5f} << ' '
+         << AllTypeVariant{2.25} << ' ' << AllTypeVariant{"text"} << ' ' << NULL_VALUE;
+  EXPECT_EQ(stream.str(), "17 -3 0.5 2.25 text NULL");
+}
+
+TYPED_TEST(AllTypeVariantTest, DataType) {
+  // the DataType of a type resolves back to it and has the type's name
+  auto data_type = std::optional<DataType>{};
+  hana::for_each(data_types, [&](const auto type_pair) {
+    if (hana::second(type_pair) == hana::type_c<TypeParam>) data_type = data_type_from_string(hana::first(type_pair));
+  });
+  ASSERT_TRUE(data_type);
+
+  auto resolved_type = std::string{};
+  resolve_data_type(*data_type, [&](const auto data_type_t) {
+    EXPECT_EQ(data_type_t, hana::type_c<TypeParam>);
+    resolved_type = data_type_to_string(*data_type);
+  });
+  EXPECT_EQ(data_type_from_string(resolved_type), *data_type);
+
+  auto stream = std::stringstream{};
+  stream << *data_type;
+  EXPECT_EQ(stream.str(), resolved_type);
+}
+
+TEST(AllTypeVariantTest, UnknownDataType) {
+  EXPECT_THROW(data_type_from_string("decimal"), std::exception);
+  EXPECT_THROW(resolve_data_type("Int", [](const auto) {}), std::exception);
+}
+
 }  // namespace opossum
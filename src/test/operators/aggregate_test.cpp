@@ -0,0 +1,213 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/aggregate.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/storage/global_dictionary.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 40 rows in chunks of 10, chunks 1 and 3 are dictionary encoded
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "double");
+    for (auto i = 0; i < 40; ++i) {
+      table->append({i % 4, i % 8 == 7 ? NULL_VALUE : AllTypeVariant{std::to_string(i % 2)},
+                     i % 5 == 0 ? NULL_VALUE : AllTypeVariant{i * 0.5}});
+    }
+    table->compress_chunk(ChunkID{1}, {EncodingType::Dictionary});
+    table->compress_chunk(ChunkID{3}, {EncodingType::Dictionary});
+    _table_wrapper = _wrap(table);
+  }
+
+  static std::shared_ptr<TableWrapper> _wrap(std::shared_ptr<const Table> table) {
+    auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<const Table> _aggregate(const std::shared_ptr<const AbstractOperator>& in,
+                                          const std::vector<AggregateDefinition>& aggregates,
+                                          const std::vector<ColumnID>& group_by_column_ids) {
+    auto aggregate = std::make_shared<Aggregate>(in, aggregates, group_by_column_ids);
+    aggregate->execute();
+    return aggregate->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsAggregateTest, GroupBySingleColumn) {
+  const auto output = _aggregate(_table_wrapper,
+                                 {{ColumnID{2}, AggregateFunction::Sum},
+                                  {ColumnID{2}, AggregateFunction::Count},
+                                  {ColumnID{2}, AggregateFunction::Avg},
+                                  {ColumnID{2}, AggregateFunction::Min},
+                                  {ColumnID{0}, AggregateFunction::Max}},
+                                 {ColumnID{0}});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("SUM(c)", "double");
+  expected->add_column("COUNT(c)", "long");
+  expected->add_column("AVG(c)", "double");
+  expected->add_column("MIN(c)", "double");
+  expected->add_column("MAX(a)", "int");
+  // rows with a == 0 are 0, 4, ..., 36, of which 0, 20 are NULL in c
+  expected->append({0, 80.0, int64_t{8}, 10.0, 2.0, 0});
+  expected->append({1, 80.0, int64_t{8}, 10.0, 0.5, 1});
+  expected->append({2, 80.0, int64_t{8}, 10.0, 1.0, 2});
+  expected->append({3, 80.0, int64_t{8}, 10.0, 1.5, 3});
+  EXPECT_TABLE_EQ(output, expected);
+}
+
+TEST_F(OperatorsAggregateTest, GroupByMultipleColumnsWithNulls) {
+  const auto output = _aggregate(_table_wrapper, {{ColumnID{0}, AggregateFunction::Count}}, {ColumnID{1}, ColumnID{0}});
+
+  // NULLs in b form their own group, they only occur for a == 3
+  auto expected = std::make_shared<Table>();
+  expected->add_column("b", "string");
+  expected->add_column("a", "int");
+  expected->add_column("COUNT(a)", "long");
+  expected->append({"0", 0, int64_t{10}});
+  expected->append({"1", 1, int64_t{10}});
+  expected->append({"0", 2, int64_t{10}});
+  expected->append({"1", 3, int64_t{5}});
+  expected->append({NULL_VALUE, 3, int64_t{5}});
+  EXPECT_TABLE_EQ(output, expected);
+}
+
+TEST_F(OperatorsAggregateTest, GroupByDictionaryEncodedStrings) {
+  // b is dictionary encoded in half of the chunks, whose groups are looked up by ValueID
+  const auto output = _aggregate(_table_wrapper,
+                                 {{ColumnID{0}, AggregateFunction::Sum}, {ColumnID{1}, AggregateFunction::Max}},
+                                 {ColumnID{1}});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("b", "string");
+  expected->add_column("SUM(a)", "long");
+  expected->add_column("MAX(b)", "string");
+  expected->append({"0", int64_t{20}, "0"});
+  expected->append({"1", int64_t{25}, "1"});
+  expected->append({NULL_VALUE, int64_t{15}, NULL_VALUE});
+  EXPECT_TABLE_EQ(output, expected);
+}
+
+TEST_F(OperatorsAggregateTest, GroupByGlobalDictionary) {
+  // the dictionary of 50 values is shared by chunks of ten distinct rows, which are therefore grouped by sorting
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  for (auto i = 0; i < 100; ++i) table->append({i % 50});
+  const auto dictionary = build_global_dictionary({{table, ColumnID{0}}});
+  for (auto chunk_id = ChunkID{0}; chunk_id < 10; ++chunk_id) table->compress_chunk(chunk_id, {dictionary});
+
+  const auto output = _aggregate(_wrap(table), {{ColumnID{0}, AggregateFunction::Count}}, {ColumnID{0}});
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("COUNT(a)", "long");
+  for (auto i = 0; i < 50; ++i) expected->append({i, int64_t{2}});
+  EXPECT_TABLE_EQ(output, expected);
+}
+
+TEST_F(OperatorsAggregateTest, NoGroupByColumns) {
+  const auto output = _aggregate(
+      _table_wrapper, {{ColumnID{0}, AggregateFunction::Sum}, {ColumnID{1}, AggregateFunction::Count}}, {});
+  EXPECT_EQ(output->row_count(), 1u);
+  EXPECT_EQ((*output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))[0], AllTypeVariant{int64_t{60}});
+  EXPECT_EQ((*output->get_chunk(ChunkID{0})->get_segment(ColumnID{1}))[0], AllTypeVariant{int64_t{35}});
+
+  // without group-by columns, an empty input still yields a row
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 10);
+  scan->execute();
+  const auto empty_output =
+      _aggregate(scan, {{ColumnID{0}, AggregateFunction::Sum}, {ColumnID{0}, AggregateFunction::Count}}, {});
+  EXPECT_EQ(empty_output->row_count(), 1u);
+  EXPECT_TRUE(variant_is_null((*empty_output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))[0]));
+  EXPECT_EQ((*empty_output->get_chunk(ChunkID{0})->get_segment(ColumnID{1}))[0], AllTypeVariant{int64_t{0}});
+
+  EXPECT_EQ(_aggregate(scan, {{ColumnID{0}, AggregateFunction::Sum}}, {ColumnID{0}})->row_count(), 0u);
+}
+
+TEST_F(OperatorsAggregateTest, ManyGroupsInParallel) {
+  auto table = std::make_shared<Table>(1'000);
+  table->add_column("a", "long");
+  table->add_column("b", "int");
+  for (auto i = 0; i < 20'000; ++i) table->append({int64_t{i % 3'000}, i});
+  for (auto chunk_id = ChunkID{0}; chunk_id < 10; ++chunk_id) table->compress_chunk(chunk_id);
+
+  TaskScheduler::get().begin(4);
+  const auto output = _aggregate(_wrap(table), {{ColumnID{1}, AggregateFunction::Count}}, {ColumnID{0}});
+  EXPECT_EQ(output->row_count(), 3'000u);
+  EXPECT_EQ(output->chunk_count(), 3u);
+  auto total_count = int64_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& segment = *output->get_chunk(chunk_id)->get_segment(ColumnID{1});
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+      total_count += type_cast<int64_t>(segment[chunk_offset]);
+    }
+  }
+  EXPECT_EQ(total_count, 20'000);
+}
+
+TEST_F(OperatorsAggregateTest, GroupByNumericColumnsWithManyGroups) {
+  // c is distinct except for NULLs, so the compressed chunks 1 and 3 are grouped by sorting and the others by hashing
+  const auto output = _aggregate(_table_wrapper, {{ColumnID{0}, AggregateFunction::Count}}, {ColumnID{2}, ColumnID{0}});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("c", "double");
+  expected->add_column("a", "int");
+  expected->add_column("COUNT(a)", "long");
+  for (auto i = 0; i < 40; ++i) {
+    if (i % 5 != 0) expected->append({i * 0.5, i % 4, int64_t{1}});
+  }
+  for (auto a = 0; a < 4; ++a) expected->append({NULL_VALUE, a, int64_t{2}});
+  EXPECT_TABLE_EQ(output, expected);
+}
+
+TEST_F(OperatorsAggregateTest, PackedGroupKeys) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "long");
+  table->add_column("b", "float");
+  for (auto i = 0; i < 20; ++i) {
+    table->append({int64_t{-i % 7}, i % 10 == 9 ? NULL_VALUE : AllTypeVariant{i % 10 == 0 ? -0.0f : i * 0.25f}});
+  }
+
+  // 0.0 and -0.0 are equal, so the rows 0 and 20 form a group with the key (0, 0)
+  table->append({int64_t{0}, 0.0f});
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "long");
+  expected->add_column("b", "float");
+  expected->add_column("COUNT(a)", "long");
+  expected->append({int64_t{0}, 0.0f, int64_t{2}});
+  for (auto i = 1; i < 20; ++i) {
+    if (i % 10 == 9) continue;
+    expected->append({int64_t{-i % 7}, i % 10 == 0 ? 0.0f : i * 0.25f, int64_t{1}});
+  }
+  expected->append({int64_t{-2}, NULL_VALUE, int64_t{1}});
+  expected->append({int64_t{-5}, NULL_VALUE, int64_t{1}});
+
+  // the packed keys are hashed for the uncompressed table and sorted once its chunks are compressed
+  const auto aggregates = std::vector<AggregateDefinition>{{ColumnID{0}, AggregateFunction::Count}};
+  EXPECT_TABLE_EQ(_aggregate(_wrap(table), aggregates, {ColumnID{0}, ColumnID{1}}), expected);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) table->compress_chunk(chunk_id);
+  EXPECT_TABLE_EQ(_aggregate(_wrap(table), aggregates, {ColumnID{0}, ColumnID{1}}), expected);
+}
+
+TEST_F(OperatorsAggregateTest, InvalidAggregates) {
+  EXPECT_THROW(_aggregate(_table_wrapper, {{ColumnID{1}, AggregateFunction::Sum}}, {}), std::exception);
+  EXPECT_THROW(_aggregate(_table_wrapper, {{ColumnID{1}, AggregateFunction::Avg}}, {ColumnID{0}}), std::exception);
+}
+
+}  // namespace opossum
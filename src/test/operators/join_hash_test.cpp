@@ -0,0 +1,229 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/global_dictionary.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // fact table with a foreign key into the dimension table, every fifth key is NULL
+    auto facts = std::make_shared<Table>(10);
+    facts->add_column("dimension_id", "int");
+    facts->add_column("amount", "double");
+    for (auto i = 0; i < 50; ++i) {
+      facts->append({i % 5 == 4 ? NULL_VALUE : AllTypeVariant{i % 7}, i * 1.5});
+    }
+    facts->compress_chunk(ChunkID{2}, {EncodingType::Dictionary});
+    _facts = _wrap(facts);
+
+    // the dimension table lacks id 6 and holds id 3 twice
+    auto dimensions = std::make_shared<Table>(3);
+    dimensions->add_column("id", "int");
+    dimensions->add_column("name", "string");
+    for (const auto id : {0, 1, 2, 3, 3, 4, 5}) {
+      dimensions->append({id, "dimension_" + std::to_string(id)});
+    }
+    dimensions->compress_chunk(ChunkID{1}, {EncodingType::Dictionary});
+    _dimensions = _wrap(dimensions);
+  }
+
+  static std::shared_ptr<TableWrapper> _wrap(std::shared_ptr<const Table> table) {
+    auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // computes the join result row by row
+  static std::shared_ptr<Table> _expected_join(const Table& facts, const Table& dimensions) {
+    auto expected = std::make_shared<Table>();
+    expected->add_column("dimension_id", "int");
+    expected->add_column("amount", "double");
+    expected->add_column("id", "int");
+    expected->add_column("name", "string");
+    for (auto fact_chunk_id = ChunkID{0}; fact_chunk_id < facts.chunk_count(); ++fact_chunk_id) {
+      const auto fact_chunk = facts.get_chunk(fact_chunk_id);
+      for (auto fact_offset = ChunkOffset{0}; fact_offset < fact_chunk->size(); ++fact_offset) {
+        const auto key = (*fact_chunk->get_segment(ColumnID{0}))[fact_offset];
+        for (auto dimension_chunk_id = ChunkID{0}; dimension_chunk_id < dimensions.chunk_count();
+             ++dimension_chunk_id) {
+          const auto dimension_chunk = dimensions.get_chunk(dimension_chunk_id);
+          for (auto dimension_offset = ChunkOffset{0}; dimension_offset < dimension_chunk->size(); ++dimension_offset) {
+            if (!(key == (*dimension_chunk->get_segment(ColumnID{0}))[dimension_offset])) continue;
+            expected->append({key, (*fact_chunk->get_segment(ColumnID{1}))[fact_offset], key,
+                              (*dimension_chunk->get_segment(ColumnID{1}))[dimension_offset]});
+          }
+        }
+      }
+    }
+    return expected;
+  }
+
+  std::shared_ptr<TableWrapper> _facts, _dimensions;
+};
+
+TEST_F(OperatorsJoinHashTest, JoinFactsWithDimensions) {
+  auto join = std::make_shared<JoinHash>(_facts, _dimensions, ColumnID{0}, ColumnID{0});
+  join->execute();
+  const auto output = join->get_output();
+
+  // NULLs and keys without a dimension do not match, key 3 matches twice
+  const auto expected = _expected_join(*_facts->get_output(), *_dimensions->get_output());
+  EXPECT_EQ(expected->row_count(), 40u);
+  EXPECT_TABLE_EQ(output, expected);
+  EXPECT_EQ(output->column_name(ColumnID{3}), "name");
+
+  // the output references the inputs, the left columns share one PosList and the right columns another
+  const auto chunk = output->get_chunk(ChunkID{0});
+  const auto left_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{1}));
+  const auto right_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{2}));
+  ASSERT_TRUE(left_segment && right_segment);
+  EXPECT_EQ(left_segment->referenced_table(), _facts->get_output());
+  EXPECT_EQ(right_segment->referenced_table(), _dimensions->get_output());
+  EXPECT_EQ(std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}))->pos_list(),
+            left_segment->pos_list());
+}
+
+TEST_F(OperatorsJoinHashTest, BuildOnEitherSide) {
+  // the hash table is built on the smaller input, which is the left one here
+  auto join = std::make_shared<JoinHash>(_dimensions, _facts, ColumnID{0}, ColumnID{0});
+  join->execute();
+  const auto output = join->get_output();
+  EXPECT_EQ(output->row_count(), 40u);
+  EXPECT_EQ(output->column_name(ColumnID{0}), "id");
+  EXPECT_EQ(output->column_name(ColumnID{2}), "dimension_id");
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto chunk = output->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      EXPECT_EQ((*chunk->get_segment(ColumnID{0}))[chunk_offset], (*chunk->get_segment(ColumnID{2}))[chunk_offset]);
+    }
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, JoinReferenceSegments) {
+  auto fact_scan = std::make_shared<TableScan>(_facts, ColumnID{1}, ScanType::OpLessThan, 30.0);
+  fact_scan->execute();
+  auto dimension_scan = std::make_shared<TableScan>(_dimensions, ColumnID{0}, ScanType::OpNotEquals, 2);
+  dimension_scan->execute();
+
+  auto join = std::make_shared<JoinHash>(fact_scan, dimension_scan, ColumnID{0}, ColumnID{0});
+  join->execute();
+  const auto output = join->get_output();
+  EXPECT_TABLE_EQ(output, _expected_join(*fact_scan->get_output(), *dimension_scan->get_output()));
+
+  // the output references the original tables, not the outputs of the scans
+  const auto chunk = output->get_chunk(ChunkID{0});
+  EXPECT_EQ(std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}))->referenced_table(),
+            _facts->get_output());
+  EXPECT_EQ(std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{3}))->referenced_table(),
+            _dimensions->get_output());
+}
+
+TEST_F(OperatorsJoinHashTest, MixedReferenceSegmentsAreRejected) {
+  // the first chunk holds ValueSegments, the second one ReferenceSegments
+  auto fact_scan = std::make_shared<TableScan>(_facts, ColumnID{1}, ScanType::OpLessThan, 30.0);
+  fact_scan->execute();
+  auto mixed_table = std::make_shared<Table>(10);
+  mixed_table->add_column("dimension_id", "int");
+  mixed_table->add_column("amount", "double");
+  mixed_table->append({1, 1.5});
+  auto reference_chunk = std::make_unique<Chunk>();
+  for (auto column_id = ColumnID{0}; column_id < 2; ++column_id) {
+    reference_chunk->add_segment(fact_scan->get_output()->get_chunk(ChunkID{0})->get_segment(column_id));
+  }
+  mixed_table->emplace_chunk(std::move(reference_chunk));
+
+  auto join = std::make_shared<JoinHash>(_wrap(mixed_table), _dimensions, ColumnID{0}, ColumnID{0});
+  EXPECT_THROW(join->execute(), std::exception);
+}
+
+TEST_F(OperatorsJoinHashTest, JoinStrings) {
+  auto join = std::make_shared<JoinHash>(_dimensions, _dimensions, ColumnID{1}, ColumnID{1});
+  join->execute();
+  // every name matches itself, the two rows of id 3 also match each other
+  EXPECT_EQ(join->get_output()->row_count(), 9u);
+}
+
+TEST_F(OperatorsJoinHashTest, JoinOnSharedDictionary) {
+  auto facts = std::make_shared<Table>(100);
+  facts->add_column("key", "string");
+  for (auto i = 0; i < 1'000; ++i) facts->append({i % 10 == 9 ? NULL_VALUE : AllTypeVariant{std::to_string(i % 37)}});
+  auto dimensions = std::make_shared<Table>(10);
+  dimensions->add_column("key", "string");
+  for (auto i = 0; i < 30; ++i) dimensions->append({std::to_string(i)});
+
+  // the join on the uncompressed tables serves as the reference
+  auto expected_join = std::make_shared<JoinHash>(_wrap(facts), _wrap(dimensions), ColumnID{0}, ColumnID{0});
+  expected_join->execute();
+
+  // both columns are encoded with a merged dictionary, so that the join compares ValueIDs
+  const auto dictionary = build_global_dictionary({{facts, ColumnID{0}}, {dimensions, ColumnID{0}}});
+  for (const auto& table : {facts, dimensions}) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      table->compress_chunk(chunk_id, {dictionary});
+    }
+  }
+  const auto& fact_segment = static_cast<const DictionarySegment<std::string>&>(
+      *facts->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  const auto& dimension_segment = static_cast<const DictionarySegment<std::string>&>(
+      *dimensions->get_chunk(ChunkID{2})->get_segment(ColumnID{0}));
+  EXPECT_EQ(fact_segment.dictionary(), dimension_segment.dictionary());
+
+  TaskScheduler::get().begin(4);
+  auto join = std::make_shared<JoinHash>(_wrap(dimensions), _wrap(facts), ColumnID{0}, ColumnID{0});
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 729u);
+  EXPECT_TABLE_EQ(join->get_output(), expected_join->get_output());
+}
+
+TEST_F(OperatorsJoinHashTest, ManyPartitionsInParallel) {
+  // the build side is too large for a single partition to fit into the L2 cache
+  auto build_table = std::make_shared<Table>(10'000);
+  build_table->add_column("a", "long");
+  for (auto i = int64_t{0}; i < 100'000; ++i) build_table->append({i});
+  auto probe_table = std::make_shared<Table>(10'000);
+  probe_table->add_column("b", "long");
+  for (auto i = int64_t{0}; i < 120'000; ++i) probe_table->append({i * 3});
+
+  TaskScheduler::get().begin(4);
+  auto join = std::make_shared<JoinHash>(_wrap(probe_table), _wrap(build_table), ColumnID{0}, ColumnID{0});
+  join->execute();
+  const auto output = join->get_output();
+  EXPECT_EQ(output->row_count(), 33'334u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto chunk = output->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      ASSERT_EQ((*chunk->get_segment(ColumnID{0}))[chunk_offset], (*chunk->get_segment(ColumnID{1}))[chunk_offset]);
+    }
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, JoinEmptyTable) {
+  auto empty_table = std::make_shared<Table>();
+  empty_table->add_column("id", "int");
+  auto join = std::make_shared<JoinHash>(_facts, _wrap(empty_table), ColumnID{0}, ColumnID{0});
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 0u);
+  EXPECT_EQ(join->get_output()->column_count(), 3u);
+}
+
+TEST_F(OperatorsJoinHashTest, RequiresMatchingTypes) {
+  auto join = std::make_shared<JoinHash>(_facts, _dimensions, ColumnID{0}, ColumnID{1});
+  EXPECT_THROW(join->execute(), std::exception);
+}
+
+}  // namespace opossum
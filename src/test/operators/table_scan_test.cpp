@@ -0,0 +1,319 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/frame_of_reference_segment.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _table_wrapper->execute();
+
+    // 10 values per chunk, chunk 1 and 3 are dictionary encoded
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (auto i = 0; i < 40; ++i) {
+      table->append({i % 20, std::to_string(i % 20)});
+    }
+    table->compress_chunk(ChunkID{1}, {EncodingType::Dictionary});
+    table->compress_chunk(ChunkID{3}, {EncodingType::Dictionary});
+    _table_wrapper_even_dict = std::make_shared<TableWrapper>(std::move(table));
+    _table_wrapper_even_dict->execute();
+  }
+
+  std::vector<int> _scan_column_a(const ScanType scan_type, const AllTypeVariant& search_value,
+                                  const ColumnID column_id = ColumnID{0}) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, column_id, scan_type, search_value);
+    scan->execute();
+    const auto& table = *scan->get_output();
+
+    auto values = std::vector<int>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& segment = *table.get_chunk(chunk_id)->get_segment(ColumnID{0});
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+        values.emplace_back(type_cast<int>(segment[chunk_offset]));
+      }
+    }
+    return values;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_even_dict;
+};
+
+TEST_F(OperatorsTableScanTest, ScanValueSegments) {
+  const auto expected_result = load_table("src/test/tables/int_float_filtered2.tbl", 1);
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan->execute();
+  EXPECT_TABLE_EQ(scan->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, ScanFloatColumn) {
+  const auto expected_result = load_table("src/test/tables/int_float_filtered.tbl", 1);
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpEquals, 457.7);
+  scan->execute();
+  EXPECT_TABLE_EQ(scan->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, ScanAllScanTypesOnMixedEncodings) {
+  // every value 0..19 occurs twice, once in a value segment and once in a dictionary segment
+  const auto expected = [](const auto& predicate) {
+    auto values = std::vector<int>{};
+    for (auto i = 0; i < 40; ++i) {
+      if (predicate(i % 20)) values.emplace_back(i % 20);
+    }
+    return values;
+  };
+
+  EXPECT_EQ(_scan_column_a(ScanType::OpEquals, 12), expected([](int v) { return v == 12; }));
+  EXPECT_EQ(_scan_column_a(ScanType::OpNotEquals, 12), expected([](int v) { return v != 12; }));
+  EXPECT_EQ(_scan_column_a(ScanType::OpLessThan, 12), expected([](int v) { return v < 12; }));
+  EXPECT_EQ(_scan_column_a(ScanType::OpLessThanEquals, 12), expected([](int v) { return v <= 12; }));
+  EXPECT_EQ(_scan_column_a(ScanType::OpGreaterThan, 12), expected([](int v) { return v > 12; }));
+  EXPECT_EQ(_scan_column_a(ScanType::OpGreaterThanEquals, 12), expected([](int v) { return v >= 12; }));
+}
+
+TEST_F(OperatorsTableScanTest, ScanValuesNotInDictionary) {
+  EXPECT_TRUE(_scan_column_a(ScanType::OpEquals, 50).empty());
+  EXPECT_EQ(_scan_column_a(ScanType::OpNotEquals, 50).size(), 40u);
+  EXPECT_EQ(_scan_column_a(ScanType::OpLessThan, 50).size(), 40u);
+  EXPECT_TRUE(_scan_column_a(ScanType::OpGreaterThan, 50).empty());
+  EXPECT_EQ(_scan_column_a(ScanType::OpGreaterThanEquals, -1).size(), 40u);
+  EXPECT_TRUE(_scan_column_a(ScanType::OpLessThanEquals, -1).empty());
+}
+
+TEST_F(OperatorsTableScanTest, ScanIntColumnWithNonIntegralValues) {
+  const auto expected = [](const auto& predicate) {
+    auto values = std::vector<int>{};
+    for (auto i = 0; i < 40; ++i) {
+      if (predicate(i % 20)) values.emplace_back(i % 20);
+    }
+    return values;
+  };
+
+  EXPECT_EQ(_scan_column_a(ScanType::OpLessThan, 3.5), expected([](int v) { return v <= 3; }));
+  EXPECT_EQ(_scan_column_a(ScanType::OpLessThanEquals, 3.5f), expected([](int v) { return v <= 3; }));
+  EXPECT_EQ(_scan_column_a(ScanType::OpGreaterThan, 3.5), expected([](int v) { return v >= 4; }));
+  EXPECT_EQ(_scan_column_a(ScanType::OpGreaterThan, -0.5), expected([](int v) { return v >= 0; }));
+  EXPECT_EQ(_scan_column_a(ScanType::OpGreaterThanEquals, -0.5), expected([](int v) { return v >= 0; }));
+  EXPECT_TRUE(_scan_column_a(ScanType::OpEquals, 3.5).empty());
+  EXPECT_EQ(_scan_column_a(ScanType::OpNotEquals, 3.5).size(), 40u);
+  EXPECT_EQ(_scan_column_a(ScanType::OpEquals, 3.0), (std::vector<int>{3, 3}));
+
+  // values out of the range of int are clamped
+  EXPECT_EQ(_scan_column_a(ScanType::OpLessThan, int64_t{1} << 40).size(), 40u);
+  EXPECT_TRUE(_scan_column_a(ScanType::OpGreaterThan, 1e20).empty());
+  EXPECT_EQ(_scan_column_a(ScanType::OpGreaterThan, -1e20).size(), 40u);
+}
+
+TEST_F(OperatorsTableScanTest, ScanStringColumn) {
+  // strings are compared lexicographically: "10" < "2"
+  EXPECT_EQ(_scan_column_a(ScanType::OpLessThan, "2", ColumnID{1}).size(), 24u);
+  EXPECT_EQ(_scan_column_a(ScanType::OpEquals, "7", ColumnID{1}), (std::vector<int>{7, 7}));
+}
+
+TEST_F(OperatorsTableScanTest, ScanRunLengthSegments) {
+  // runs of ten rows, the run of 2s is NULL
+  auto table = std::make_shared<Table>(50);
+  table->add_column("a", "int");
+  for (auto chunk_index = 0; chunk_index < 2; ++chunk_index) {
+    auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+    for (auto row_id = 0; row_id < 50; ++row_id) {
+      value_segment->append(row_id / 10 == 2 ? NULL_VALUE : AllTypeVariant{row_id / 10});
+    }
+    auto chunk = std::make_unique<Chunk>();
+    chunk->add_segment(std::make_shared<RunLengthSegment<int32_t>>(value_segment));
+    table->emplace_chunk(std::move(chunk));
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto scan_row_count = [&](const ScanType scan_type, const AllTypeVariant& search_value) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+    scan->execute();
+    return scan->get_output()->row_count();
+  };
+  EXPECT_EQ(scan_row_count(ScanType::OpEquals, 1), 20u);
+  EXPECT_EQ(scan_row_count(ScanType::OpEquals, 2), 0u);
+  EXPECT_EQ(scan_row_count(ScanType::OpNotEquals, 1), 60u);
+  EXPECT_EQ(scan_row_count(ScanType::OpLessThan, 3), 40u);
+  EXPECT_EQ(scan_row_count(ScanType::OpGreaterThanEquals, 3), 40u);
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 3);
+  scan->execute();
+  const auto& segment = static_cast<const ReferenceSegment&>(*scan->get_output()->get_chunk(ChunkID{1})->get_segment(
+      ColumnID{0}));
+  EXPECT_EQ(segment.pos_list()->front(), (RowID{ChunkID{1}, 40}));
+  EXPECT_EQ(segment.pos_list()->back(), (RowID{ChunkID{1}, 49}));
+}
+
+TEST_F(OperatorsTableScanTest, ScanFrameOfReferenceSegments) {
+  // two chunks with the same values, the second one is frame-of-reference encoded. The blocks hold narrow ranges far
+  // apart from each other, some values are NULL.
+  auto table = std::make_shared<Table>(3'000);
+  table->add_column("a", "long");
+  auto value_segment = std::make_shared<ValueSegment<int64_t>>();
+  for (auto row_id = int64_t{0}; row_id < 3'000; ++row_id) {
+    value_segment->append(row_id % 11 == 0 ? NULL_VALUE : AllTypeVariant{(row_id / 1'024) * 1'000 - 500 + row_id % 7});
+  }
+  for (const auto& segment : std::vector<std::shared_ptr<BaseSegment>>{
+           value_segment, std::make_shared<FrameOfReferenceSegment<int64_t>>(value_segment)}) {
+    auto chunk = std::make_unique<Chunk>();
+    chunk->add_segment(segment);
+    table->emplace_chunk(std::move(chunk));
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    for (const auto search_value : {int64_t{-1'000}, int64_t{-500}, int64_t{-497}, int64_t{0}, int64_t{503},
+                                    int64_t{1'506}, int64_t{2'000}}) {
+      auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+      scan->execute();
+      const auto& output = *scan->get_output();
+      auto matches_per_chunk = std::array<std::vector<ChunkOffset>, 2>{};
+      for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+        // a scan without matches returns the empty initial chunk of the output table, which holds no ReferenceSegment
+        if (output.get_chunk(chunk_id)->size() == 0) continue;
+        const auto& segment =
+            static_cast<const ReferenceSegment&>(*output.get_chunk(chunk_id)->get_segment(ColumnID{0}));
+        for (const auto& row_id : *segment.pos_list()) {
+          matches_per_chunk[row_id.chunk_id].emplace_back(row_id.chunk_offset);
+        }
+      }
+      EXPECT_FALSE(matches_per_chunk[0].empty() && scan_type == ScanType::OpNotEquals);
+      EXPECT_EQ(matches_per_chunk[1], matches_per_chunk[0]);
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, SkipChunksByStatistics) {
+  // the compressed chunk 1 holds the values 10..19, so scans for values outside of that range skip it
+  const auto& table = *_table_wrapper_even_dict->get_output();
+  EXPECT_FALSE(table.get_chunk(ChunkID{0})->statistics());
+  const auto statistics = table.get_chunk(ChunkID{1})->statistics();
+  ASSERT_TRUE(statistics);
+  EXPECT_EQ((*statistics)[0].min, AllTypeVariant{10});
+  EXPECT_EQ((*statistics)[0].max, AllTypeVariant{19});
+
+  // The statistics are trusted without looking at the segment. Statistics that claim the chunk only holds 100 show
+  // which chunks are skipped.
+  const auto chunk = std::const_pointer_cast<Chunk>(table.get_chunk(ChunkID{1}));
+  chunk->set_statistics(std::make_shared<ChunkStatistics>(
+      ChunkStatistics{SegmentStatistics{100, 100, 1, 0}, SegmentStatistics{"100", "100", 1, 0}}));
+  EXPECT_EQ(_scan_column_a(ScanType::OpEquals, 15), (std::vector<int>{15}));
+  EXPECT_EQ(_scan_column_a(ScanType::OpNotEquals, 100).size(), 30u);
+  EXPECT_EQ(_scan_column_a(ScanType::OpLessThan, 100).size(), 30u);
+  EXPECT_EQ(_scan_column_a(ScanType::OpGreaterThan, 99).size(), 0u);
+
+  // chunks that are not skipped are scanned as usual
+  EXPECT_EQ(_scan_column_a(ScanType::OpLessThanEquals, 100).size(), 40u);
+  EXPECT_EQ(_scan_column_a(ScanType::OpGreaterThanEquals, 5).size(), 30u);
+
+  // segments that only hold NULLs never match
+  chunk->set_statistics(std::make_shared<ChunkStatistics>(
+      ChunkStatistics{SegmentStatistics{NULL_VALUE, NULL_VALUE, 0, 10}, SegmentStatistics{}}));
+  EXPECT_EQ(_scan_column_a(ScanType::OpNotEquals, 100).size(), 30u);
+}
+
+TEST_F(OperatorsTableScanTest, OutputReferencesInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpEquals, 3);
+  EXPECT_THROW(scan->get_output(), std::exception);
+  scan->execute();
+  EXPECT_EQ(scan->column_id(), ColumnID{0});
+  EXPECT_EQ(scan->scan_type(), ScanType::OpEquals);
+  EXPECT_EQ(scan->search_value(), AllTypeVariant{3});
+
+  // one output chunk per input chunk with matches, all columns share the PosList
+  const auto output = scan->get_output();
+  EXPECT_EQ(output->chunk_count(), 2u);
+  const auto chunk = output->get_chunk(ChunkID{1});
+  const auto segment_a = std::dynamic_pointer_cast<ReferenceSegment>(chunk->get_segment(ColumnID{0}));
+  const auto segment_b = std::dynamic_pointer_cast<ReferenceSegment>(chunk->get_segment(ColumnID{1}));
+  ASSERT_TRUE(segment_a && segment_b);
+  EXPECT_EQ(segment_a->referenced_table(), _table_wrapper_even_dict->get_output());
+  EXPECT_EQ(segment_a->referenced_column_id(), ColumnID{0});
+  EXPECT_EQ(segment_b->referenced_column_id(), ColumnID{1});
+  EXPECT_EQ(segment_a->pos_list(), segment_b->pos_list());
+  EXPECT_EQ(*segment_a->pos_list(), (PosList{RowID{ChunkID{2}, 3}}));
+}
+
+TEST_F(OperatorsTableScanTest, ScanReferenceSegments) {
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpGreaterThan, 5);
+  scan_1->execute();
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, "8");
+  scan_2->execute();
+
+  const auto output = scan_2->get_output();
+  auto values = std::vector<AllTypeVariant>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto chunk = output->get_chunk(chunk_id);
+    const auto segment = std::dynamic_pointer_cast<ReferenceSegment>(chunk->get_segment(ColumnID{0}));
+    ASSERT_TRUE(segment);
+    // the output of the second scan references the original table, not the output of the first scan
+    EXPECT_EQ(segment->referenced_table(), _table_wrapper_even_dict->get_output());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); ++chunk_offset) {
+      values.emplace_back((*segment)[chunk_offset]);
+    }
+  }
+  // 6 and 7 pass both predicates, as do 10..19, which are compared as strings
+  EXPECT_EQ(values.size(), 24u);
+}
+
+TEST_F(OperatorsTableScanTest, ScanNulls) {
+  // every third value is NULL, the second chunk is dictionary encoded
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  for (auto i = 0; i < 200; ++i) {
+    table->append({i % 3 == 0 ? NULL_VALUE : AllTypeVariant{i % 10}});
+  }
+  table->compress_chunk(ChunkID{1}, {EncodingType::Dictionary});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto row_count = [&](const std::shared_ptr<const AbstractOperator>& input, const ScanType scan_type,
+                             const AllTypeVariant& search_value) {
+    auto scan = std::make_shared<TableScan>(input, ColumnID{0}, scan_type, search_value);
+    scan->execute();
+    return scan->get_output()->row_count();
+  };
+
+  // NULLs never match, not even negated predicates or predicates that match all other values
+  EXPECT_EQ(row_count(table_wrapper, ScanType::OpNotEquals, 100), 133u);
+  EXPECT_EQ(row_count(table_wrapper, ScanType::OpGreaterThanEquals, 0), 133u);
+  EXPECT_EQ(row_count(table_wrapper, ScanType::OpEquals, 0), 13u);
+  EXPECT_EQ(row_count(table_wrapper, ScanType::OpEquals, NULL_VALUE), 0u);
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+  scan->execute();
+  EXPECT_EQ(row_count(scan, ScanType::OpNotEquals, 100), scan->get_output()->row_count());
+}
+
+TEST_F(OperatorsTableScanTest, ScanEmptyTable) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 3);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(scan->get_output()->column_count(), 1u);
+}
+
+}  // namespace opossum
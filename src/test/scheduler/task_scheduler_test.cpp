@@ -0,0 +1,130 @@
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/scheduler/job_task.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class SchedulerTaskSchedulerTest : public BaseTest {};
+
+TEST_F(SchedulerTaskSchedulerTest, ExecuteInlineWhenInactive) {
+  auto& scheduler = TaskScheduler::get();
+  EXPECT_FALSE(scheduler.is_active());
+  EXPECT_EQ(scheduler.worker_count(), 0u);
+
+  const auto this_thread_id = std::this_thread::get_id();
+  auto executed_on_this_thread = false;
+  auto task = std::make_shared<JobTask>([&] { executed_on_this_thread = std::this_thread::get_id() == this_thread_id; });
+  scheduler.schedule_and_wait_for_tasks({task});
+  EXPECT_TRUE(task->is_done());
+  EXPECT_TRUE(executed_on_this_thread);
+}
+
+TEST_F(SchedulerTaskSchedulerTest, ExecuteAllTasks) {
+  auto& scheduler = TaskScheduler::get();
+  scheduler.begin(4);
+  EXPECT_TRUE(scheduler.is_active());
+  EXPECT_EQ(scheduler.worker_count(), 4u);
+  EXPECT_THROW(scheduler.begin(2), std::exception);
+
+  auto counter = std::atomic<size_t>{0};
+  auto tasks = std::vector<std::shared_ptr<JobTask>>{};
+  for (auto task_id = 0; task_id < 1000; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([&] { ++counter; }));
+  }
+  scheduler.schedule_and_wait_for_tasks(tasks);
+  EXPECT_EQ(counter, 1000u);
+
+  scheduler.finish();
+  EXPECT_FALSE(scheduler.is_active());
+}
+
+TEST_F(SchedulerTaskSchedulerTest, NestedTasks) {
+  auto& scheduler = TaskScheduler::get();
+  scheduler.begin(2);
+
+  // every worker waits for nested tasks, which must not deadlock
+  auto counter = std::atomic<size_t>{0};
+  auto tasks = std::vector<std::shared_ptr<JobTask>>{};
+  for (auto task_id = 0; task_id < 8; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([&] {
+      scheduler.for_each_chunk(ChunkCount{10}, [&](const ChunkID) { ++counter; });
+    }));
+  }
+  scheduler.schedule_and_wait_for_tasks(tasks);
+  EXPECT_EQ(counter, 80u);
+}
+
+TEST_F(SchedulerTaskSchedulerTest, NotifyIdleWorkers) {
+  auto& scheduler = TaskScheduler::get();
+  scheduler.begin(2);
+
+  // Both tasks wait for each other, so at least one of them has to be executed by a worker. Workers sleep between
+  // the rounds until they are notified, a missed notification would block forever.
+  for (auto round = 0; round < 100; ++round) {
+    auto started_count = std::atomic<size_t>{0};
+    const auto waiting_task = [&] {
+      return std::make_shared<JobTask>([&] {
+        ++started_count;
+        while (started_count < 2) std::this_thread::yield();
+      });
+    };
+    scheduler.schedule_and_wait_for_tasks({waiting_task(), waiting_task()});
+    EXPECT_EQ(started_count, 2u);
+  }
+}
+
+TEST_F(SchedulerTaskSchedulerTest, RethrowExceptions) {
+  auto& scheduler = TaskScheduler::get();
+  const auto failing_task = [] { return std::make_shared<JobTask>([] { throw std::logic_error("failed"); }); };
+
+  EXPECT_THROW(scheduler.schedule_and_wait_for_tasks({failing_task()}), std::logic_error);
+  scheduler.begin(2);
+  EXPECT_THROW(scheduler.schedule_and_wait_for_tasks({failing_task(), failing_task()}), std::logic_error);
+}
+
+TEST_F(SchedulerTaskSchedulerTest, ForEachChunk) {
+  auto& scheduler = TaskScheduler::get();
+  scheduler.begin(3);
+
+  auto visited = std::vector<std::atomic<uint32_t>>(100);
+  scheduler.for_each_chunk(ChunkCount{100}, [&](const ChunkID chunk_id) { ++visited[chunk_id]; });
+  for (const auto& visit_count : visited) {
+    EXPECT_EQ(visit_count, 1u);
+  }
+}
+
+TEST_F(SchedulerTaskSchedulerTest, ParallelTableScan) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  for (auto i = 0; i < 10'000; ++i) {
+    table->append({i});
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); chunk_id += 2) {
+    table->compress_chunk(chunk_id);
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  TaskScheduler::get().begin(4);
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5'050);
+  scan->execute();
+
+  const auto output = scan->get_output();
+  EXPECT_EQ(output->row_count(), 5'050u);
+  EXPECT_EQ(output->chunk_count(), 51u);
+  // the output keeps the order of the input
+  EXPECT_EQ(output->get_chunk(ChunkID{50})->get_segment(ColumnID{0})->operator[](49), AllTypeVariant{5'049});
+}
+
+}  // namespace opossum
@@ -0,0 +1,86 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/attribute_vector_utils.hpp"
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../lib/storage/fixed_size_attribute_vector.hpp"
+
+namespace opossum {
+
+class StorageBitPackedAttributeVectorTest : public BaseTest {};
+
+TEST_F(StorageBitPackedAttributeVectorTest, SetAndGet) {
+  for (const auto bits_per_value : {uint8_t{1}, uint8_t{2}, uint8_t{4}}) {
+    const auto max_value_id = (1u << bits_per_value) - 1;
+    auto attribute_vector = BitPackedAttributeVector{200, bits_per_value};
+    EXPECT_EQ(attribute_vector.size(), 200u);
+    EXPECT_EQ(attribute_vector.width(), 1u);
+    EXPECT_EQ(attribute_vector.bits_per_value(), bits_per_value);
+
+    for (auto i = size_t{0}; i < 200; ++i) {
+      attribute_vector.set(i, ValueID{static_cast<uint32_t>(i % (max_value_id + 1))});
+    }
+    // overwriting an entry must not touch its neighbors
+    attribute_vector.set(65, ValueID{0});
+    attribute_vector.set(65, ValueID{max_value_id});
+
+    for (auto i = size_t{0}; i < 200; ++i) {
+      const auto expected = i == 65 ? max_value_id : i % (max_value_id + 1);
+      EXPECT_EQ(attribute_vector.get(i), ValueID{static_cast<uint32_t>(expected)});
+    }
+  }
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, Decode) {
+  auto attribute_vector = BitPackedAttributeVector{100, 4};
+  for (auto i = size_t{0}; i < 100; ++i) attribute_vector.set(i, ValueID{static_cast<uint32_t>(i % 16)});
+
+  // the decoded range spans several words and neither starts nor ends at a word boundary
+  auto value_ids = std::vector<ValueID>(80);
+  attribute_vector.decode(7, 87, value_ids.data());
+  for (auto i = size_t{0}; i < 80; ++i) {
+    EXPECT_EQ(value_ids[i], attribute_vector.get(i + 7));
+  }
+
+  attribute_vector.decode(5, 5, value_ids.data());
+  EXPECT_THROW(attribute_vector.decode(90, 101, value_ids.data()), std::exception);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, InvalidBitsPerValue) {
+  EXPECT_THROW(BitPackedAttributeVector(10, 3), std::exception);
+  if constexpr (HYRISE_DEBUG) {
+    auto attribute_vector = BitPackedAttributeVector{10, 2};
+    EXPECT_THROW(attribute_vector.set(0, ValueID{4}), std::exception);
+    EXPECT_THROW(attribute_vector.set(10, ValueID{1}), std::exception);
+  }
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, MemoryUsage) {
+  // 64 entries of one bit fit into a single word, 65 entries need a second one
+  EXPECT_EQ(BitPackedAttributeVector(64, 1).estimate_memory_usage(), 8u);
+  EXPECT_EQ(BitPackedAttributeVector(65, 1).estimate_memory_usage(), 16u);
+  EXPECT_EQ(BitPackedAttributeVector(100, 4).estimate_memory_usage(), 56u);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, NarrowestAttributeVector) {
+  const auto bits_per_value = [](const size_t unique_values_count) {
+    const auto attribute_vector = make_attribute_vector(1, unique_values_count);
+    const auto bit_packed_attribute_vector = std::dynamic_pointer_cast<BitPackedAttributeVector>(attribute_vector);
+    return bit_packed_attribute_vector ? bit_packed_attribute_vector->bits_per_value() : 0;
+  };
+  EXPECT_EQ(bits_per_value(1), 1u);
+  EXPECT_EQ(bits_per_value(2), 2u);
+  EXPECT_EQ(bits_per_value(3), 2u);
+  EXPECT_EQ(bits_per_value(15), 4u);
+  EXPECT_EQ(bits_per_value(16), 0u);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<FixedSizeAttributeVector<uint8_t>>(make_attribute_vector(1, 255)));
+  EXPECT_TRUE(std::dynamic_pointer_cast<FixedSizeAttributeVector<uint16_t>>(make_attribute_vector(1, 256)));
+  EXPECT_TRUE(std::dynamic_pointer_cast<FixedSizeAttributeVector<uint16_t>>(make_attribute_vector(1, 65535)));
+  EXPECT_TRUE(std::dynamic_pointer_cast<FixedSizeAttributeVector<uint32_t>>(make_attribute_vector(1, 65536)));
+}
+
+}  // namespace opossum
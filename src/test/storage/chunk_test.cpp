@@ -49,6 +49,41 @@ TEST_F(StorageChunkTest, AddValuesToChunk) {
   }
 }
 
+TEST_F(StorageChunkTest, AppendToPreallocatedSegments) {
+  c.add_segment(std::make_shared<ValueSegment<int32_t>>(ChunkOffset{2}));
+  c.add_segment(std::make_shared<ValueSegment<std::string>>(ChunkOffset{3}));
+  EXPECT_EQ(c.capacity(), 2u);
+  EXPECT_EQ(c.size(), 0u);
+
+  EXPECT_TRUE(c.append_concurrently({1, std::string{"one"}}));
+  c.append({2, "two"});
+  EXPECT_EQ(c.size(), 2u);
+  EXPECT_EQ((*c.get_segment(ColumnID{1}))[1], AllTypeVariant{"two"});
+
+  // the chunk is full, only append may grow the segments beyond their capacity
+  EXPECT_FALSE(c.append_concurrently({3, std::string{"three"}}));
+  c.append({3, "three"});
+  EXPECT_EQ(c.size(), 3u);
+  EXPECT_EQ((*c.get_segment(ColumnID{0}))[2], AllTypeVariant{3});
+}
+
+TEST_F(StorageChunkTest, AppendConcurrentlyRequiresMatchingTypes) {
+  c.add_segment(std::make_shared<ValueSegment<int32_t>>(ChunkOffset{2}));
+  EXPECT_THROW(c.append_concurrently({int64_t{1}}), std::exception);
+  EXPECT_THROW(c.append_concurrently({1, 2}), std::exception);
+  EXPECT_EQ(c.size(), 0u);
+  EXPECT_TRUE(c.append_concurrently({1}));
+  EXPECT_EQ(c.size(), 1u);
+}
+
+TEST_F(StorageChunkTest, SegmentsWithoutPreallocatedStorage) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  EXPECT_EQ(c.capacity(), 3u);
+  EXPECT_FALSE(c.append_concurrently({2, std::string{"two"}}));
+  EXPECT_EQ(c.size(), 3u);
+}
+
 TEST_F(StorageChunkTest, RetrieveSegment) {
   c.add_segment(int_value_segment);
   c.add_segment(string_value_segment);
@@ -10,61 +10,157 @@
 
 namespace opossum {
 
-// class StorageDictionarySegmentTest : public ::testing::Test {
-//  protected:
-//   std::shared_ptr<opossum::ValueSegment<int>> vc_int = std::make_shared<opossum::ValueSegment<int>>();
-//   std::shared_ptr<opossum::ValueSegment<std::string>> vc_str = std::make_shared<opossum::ValueSegment<std::string>>();
-// };
-
-// TEST_F(StorageDictionarySegmentTest, CompressSegmentString) {
-//   vc_str->append("Bill");
-//   vc_str->append("Steve");
-//   vc_str->append("Alexander");
-//   vc_str->append("Steve");
-//   vc_str->append("Hasso");
-//   vc_str->append("Bill");
-
-//   std::shared_ptr<BaseSegment> col;
-//   resolve_data_type("string", [&](auto type) {
-//     using Type = typename decltype(type)::type;
-//     col = std::make_shared<DictionarySegment<Type>>(vc_str);
-//   });
-//   auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<std::string>>(col);
-
-//   // Test attribute_vector size
-//   EXPECT_EQ(dict_col->size(), 6u);
-
-//   // Test dictionary size (uniqueness)
-//   EXPECT_EQ(dict_col->unique_values_count(), 4u);
-
-//   // Test sorting
-//   auto dict = dict_col->dictionary();
-//   EXPECT_EQ((*dict)[0], "Alexander");
-//   EXPECT_EQ((*dict)[1], "Bill");
-//   EXPECT_EQ((*dict)[2], "Hasso");
-//   EXPECT_EQ((*dict)[3], "Steve");
-// }
-
-// TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
-//   for (int i = 0; i <= 10; i += 2) vc_int->append(i);
-
-//   std::shared_ptr<BaseSegment> col;
-//   resolve_data_type("int", [&](auto type) {
-//     using Type = typename decltype(type)::type;
-//     col = std::make_shared<DictionarySegment<Type>>(vc_int);
-//   });
-//   auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<int>>(col);
-
-//   EXPECT_EQ(dict_col->lower_bound(4), (opossum::ValueID)2);
-//   EXPECT_EQ(dict_col->upper_bound(4), (opossum::ValueID)3);
-
-//   EXPECT_EQ(dict_col->lower_bound(5), (opossum::ValueID)3);
-//   EXPECT_EQ(dict_col->upper_bound(5), (opossum::ValueID)3);
-
-//   EXPECT_EQ(dict_col->lower_bound(15), opossum::INVALID_VALUE_ID);
-//   EXPECT_EQ(dict_col->upper_bound(15), opossum::INVALID_VALUE_ID);
-// }
-
-// TODO(student): You should add some more tests here (full coverage would be appreciated) and possibly in other files.
+class StorageDictionarySegmentTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<opossum::ValueSegment<int>> vc_int = std::make_shared<opossum::ValueSegment<int>>();
+  std::shared_ptr<opossum::ValueSegment<std::string>> vc_str = std::make_shared<opossum::ValueSegment<std::string>>();
+};
+
+TEST_F(StorageDictionarySegmentTest, CompressSegmentString) {
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Alexander");
+  vc_str->append("Steve");
+  vc_str->append("Hasso");
+  vc_str->append("Bill");
+
+  std::shared_ptr<BaseSegment> col;
+  resolve_data_type("string", [&](auto type) {
+    using Type = typename decltype(type)::type;
+    col = std::make_shared<DictionarySegment<Type>>(vc_str);
+  });
+  auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<std::string>>(col);
+
+  // Test attribute_vector size
+  EXPECT_EQ(dict_col->size(), 6u);
+
+  // Test dictionary size (uniqueness)
+  EXPECT_EQ(dict_col->unique_values_count(), 4u);
+
+  // Test sorting
+  auto dict = dict_col->dictionary();
+  EXPECT_EQ((*dict)[0], "Alexander");
+  EXPECT_EQ((*dict)[1], "Bill");
+  EXPECT_EQ((*dict)[2], "Hasso");
+  EXPECT_EQ((*dict)[3], "Steve");
+}
+
+TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
+  for (int i = 0; i <= 10; i += 2) vc_int->append(i);
+
+  std::shared_ptr<BaseSegment> col;
+  resolve_data_type("int", [&](auto type) {
+    using Type = typename decltype(type)::type;
+    col = std::make_shared<DictionarySegment<Type>>(vc_int);
+  });
+  auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<int>>(col);
+
+  EXPECT_EQ(dict_col->lower_bound(4), (opossum::ValueID)2);
+  EXPECT_EQ(dict_col->upper_bound(4), (opossum::ValueID)3);
+
+  EXPECT_EQ(dict_col->lower_bound(5), (opossum::ValueID)3);
+  EXPECT_EQ(dict_col->upper_bound(5), (opossum::ValueID)3);
+
+  EXPECT_EQ(dict_col->lower_bound(15), opossum::INVALID_VALUE_ID);
+  EXPECT_EQ(dict_col->upper_bound(15), opossum::INVALID_VALUE_ID);
+
+  EXPECT_EQ(dict_col->lower_bound(AllTypeVariant{4}), (opossum::ValueID)2);
+  EXPECT_EQ(dict_col->upper_bound(AllTypeVariant{4}), (opossum::ValueID)3);
+}
+
+TEST_F(StorageDictionarySegmentTest, AccessValues) {
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Bill");
+
+  const auto dict_col = std::make_shared<DictionarySegment<std::string>>(vc_str);
+
+  EXPECT_EQ(dict_col->get(0), "Bill");
+  EXPECT_EQ(dict_col->get(1), "Steve");
+  EXPECT_EQ((*dict_col)[2], AllTypeVariant{"Bill"});
+  EXPECT_EQ(dict_col->value_by_value_id(ValueID{1}), "Steve");
+
+  const auto attribute_vector = dict_col->attribute_vector();
+  EXPECT_EQ(attribute_vector->size(), 3u);
+  EXPECT_EQ(attribute_vector->get(0), ValueID{0});
+  EXPECT_EQ(attribute_vector->get(1), ValueID{1});
+  EXPECT_EQ(attribute_vector->get(2), ValueID{0});
+
+  if constexpr (HYRISE_DEBUG) {
+    EXPECT_THROW(dict_col->get(3), std::exception);
+    EXPECT_THROW(dict_col->value_by_value_id(ValueID{2}), std::exception);
+  }
+}
+
+TEST_F(StorageDictionarySegmentTest, NarrowestAttributeVector) {
+  for (int i = 0; i < 300; ++i) vc_int->append(i % 100);
+  auto dict_col = std::make_shared<DictionarySegment<int>>(vc_int);
+  EXPECT_EQ(dict_col->attribute_vector()->width(), 1u);
+  EXPECT_EQ(dict_col->get(299), 99);
+
+  for (int i = 300; i < 1000; ++i) vc_int->append(i);
+  dict_col = std::make_shared<DictionarySegment<int>>(vc_int);
+  EXPECT_EQ(dict_col->attribute_vector()->width(), 2u);
+  EXPECT_EQ(dict_col->get(999), 999);
+}
+
+TEST_F(StorageDictionarySegmentTest, MemoryUsage) {
+  for (int i = 0; i < 300; ++i) vc_int->append(i % 100);
+  const auto dict_col = std::make_shared<DictionarySegment<int>>(vc_int);
+  // 100 dictionary entries of four bytes and 300 value ids of one byte
+  EXPECT_EQ(dict_col->estimate_memory_usage(), size_t{100 * 4 + 300});
+
+  vc_str->append(std::string(50, 'a'));
+  vc_str->append("b");
+  vc_str->append(std::string(50, 'a'));
+  const auto dict_col_str = std::make_shared<DictionarySegment<std::string>>(vc_str);
+  // the long string is counted once, as it is stored in the dictionary only once
+  const auto& dictionary = *dict_col_str->dictionary();
+  EXPECT_EQ(dict_col_str->estimate_memory_usage(), 2 * sizeof(std::string) + dictionary[0].capacity() + 1 + 8);
+}
+
+TEST_F(StorageDictionarySegmentTest, Nulls) {
+  vc_int->append(3);
+  vc_int->append(NULL_VALUE);
+  vc_int->append(1);
+  vc_int->append(NULL_VALUE);
+  const auto dict_col = std::make_shared<DictionarySegment<int>>(vc_int);
+
+  // NULLs are not part of the dictionary, their value id follows the last dictionary entry
+  EXPECT_EQ(*dict_col->dictionary(), (std::vector<int>{1, 3}));
+  EXPECT_EQ(dict_col->null_value_id(), ValueID{2});
+  EXPECT_EQ(dict_col->attribute_vector()->get(1), ValueID{2});
+  EXPECT_TRUE(variant_is_null((*dict_col)[1]));
+  EXPECT_EQ((*dict_col)[2], AllTypeVariant{1});
+  EXPECT_THROW(dict_col->get(3), std::exception);
+}
+
+TEST_F(StorageDictionarySegmentTest, SharedDictionary) {
+  vc_int->append(7);
+  vc_int->append(NULL_VALUE);
+  vc_int->append(3);
+  const auto dictionary = std::make_shared<const std::vector<int>>(std::vector<int>{1, 3, 5, 7});
+  const auto dict_col = std::make_shared<DictionarySegment<int>>(vc_int, dictionary);
+
+  EXPECT_EQ(dict_col->dictionary(), dictionary);
+  EXPECT_EQ(dict_col->attribute_vector()->get(0), ValueID{3});
+  EXPECT_EQ(dict_col->attribute_vector()->get(1), dict_col->null_value_id());
+  EXPECT_EQ(dict_col->attribute_vector()->get(2), ValueID{1});
+  EXPECT_EQ((*dict_col)[2], AllTypeVariant{3});
+
+  vc_int->append(4);
+  EXPECT_THROW(std::make_shared<DictionarySegment<int>>(vc_int, dictionary), std::exception);
+}
+
+TEST_F(StorageDictionarySegmentTest, Immutable) {
+  vc_int->append(1);
+  const auto dict_col = std::make_shared<DictionarySegment<int>>(vc_int);
+  EXPECT_THROW(dict_col->append(2), std::exception);
+  EXPECT_EQ(dict_col->size(), 1u);
+}
+
+TEST_F(StorageDictionarySegmentTest, CompressOnlyValueSegmentsOfSameType) {
+  EXPECT_THROW(std::make_shared<DictionarySegment<std::string>>(vc_int), std::exception);
+}
 
 }  // namespace opossum
@@ -0,0 +1,80 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/dictionary_segment.hpp"
+#include "../../lib/storage/encoding_advisor.hpp"
+#include "../../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageEncodingAdvisorTest : public ::testing::Test {
+ protected:
+  // large enough that only a sample of the segments is looked at
+  static constexpr auto SEGMENT_SIZE = 100'000;
+
+  // visits every position once, but not in order
+  static int _shuffled(const int position) {
+    return static_cast<int>((static_cast<int64_t>(position) * 7'919) % SEGMENT_SIZE);
+  }
+};
+
+TEST_F(StorageEncodingAdvisorTest, LongRunsAreRunLengthEncoded) {
+  auto segment = ValueSegment<int>{};
+  for (auto i = 0; i < SEGMENT_SIZE; ++i) segment.append(i / 1'000);
+  EXPECT_EQ(advise_encoding(DataType::Int, segment), EncodingType::RunLength);
+
+  auto string_segment = ValueSegment<std::string>{};
+  for (auto i = 0; i < SEGMENT_SIZE; ++i) {
+    string_segment.append(i < SEGMENT_SIZE / 2 ? AllTypeVariant{"first"} : NULL_VALUE);
+  }
+  EXPECT_EQ(advise_encoding(DataType::String, string_segment), EncodingType::RunLength);
+}
+
+TEST_F(StorageEncodingAdvisorTest, FewDistinctValuesAreDictionaryEncoded) {
+  auto segment = ValueSegment<std::string>{};
+  for (auto i = 0; i < SEGMENT_SIZE; ++i) {
+    segment.append(i % 13 == 0 ? NULL_VALUE : AllTypeVariant{"category_" + std::to_string(_shuffled(i) % 10)});
+  }
+  EXPECT_EQ(advise_encoding(DataType::String, segment), EncodingType::Dictionary);
+
+  auto double_segment = ValueSegment<double>{};
+  for (auto i = 0; i < SEGMENT_SIZE; ++i) double_segment.append(_shuffled(i) % 200 * 0.5);
+  EXPECT_EQ(advise_encoding(DataType::Double, double_segment), EncodingType::Dictionary);
+}
+
+TEST_F(StorageEncodingAdvisorTest, NarrowRangesAreFrameOfReferenceEncoded) {
+  // the values are distinct, so that a dictionary does not pay off, but need only 17 bits within their range
+  auto segment = ValueSegment<int64_t>{};
+  for (auto i = 0; i < SEGMENT_SIZE; ++i) segment.append(int64_t{5'000'000'000} + _shuffled(i));
+  EXPECT_EQ(advise_encoding(DataType::Long, segment), EncodingType::FrameOfReference);
+
+  // sorted values span an even narrower range per block
+  auto sorted_segment = ValueSegment<int>{};
+  for (auto i = 0; i < SEGMENT_SIZE; ++i) sorted_segment.append(i * 1'000);
+  EXPECT_EQ(advise_encoding(DataType::Int, sorted_segment), EncodingType::FrameOfReference);
+}
+
+TEST_F(StorageEncodingAdvisorTest, IncompressibleValuesStayUnencoded) {
+  auto segment = ValueSegment<double>{};
+  for (auto i = 0; i < SEGMENT_SIZE; ++i) segment.append(_shuffled(i) * 0.5);
+  EXPECT_EQ(advise_encoding(DataType::Double, segment), EncodingType::Unencoded);
+
+  // small segments are looked at completely
+  auto small_segment = ValueSegment<float>{};
+  for (const auto value : {3.0f, 1.0f, 2.0f}) small_segment.append(value);
+  EXPECT_EQ(advise_encoding(DataType::Float, small_segment), EncodingType::Unencoded);
+
+  EXPECT_EQ(advise_encoding(DataType::Int, ValueSegment<int>{}), EncodingType::Unencoded);
+}
+
+TEST_F(StorageEncodingAdvisorTest, OnlyValueSegmentsOfTheGivenType) {
+  auto segment = std::make_shared<ValueSegment<int>>();
+  segment->append(1);
+  EXPECT_THROW(advise_encoding(DataType::Long, *segment), std::exception);
+  EXPECT_THROW(advise_encoding(DataType::Int, DictionarySegment<int>{segment}), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/fixed_size_attribute_vector.hpp"
+
+namespace opossum {
+
+class StorageFixedSizeAttributeVectorTest : public BaseTest {};
+
+TEST_F(StorageFixedSizeAttributeVectorTest, SetAndGet) {
+  auto attribute_vector = FixedSizeAttributeVector<uint16_t>{3};
+  EXPECT_EQ(attribute_vector.size(), 3u);
+  EXPECT_EQ(attribute_vector.get(0), ValueID{0});
+
+  attribute_vector.set(0, ValueID{4});
+  attribute_vector.set(2, ValueID{65535});
+  EXPECT_EQ(attribute_vector.get(0), ValueID{4});
+  EXPECT_EQ(attribute_vector.get(1), ValueID{0});
+  EXPECT_EQ(attribute_vector.get(2), ValueID{65535});
+
+  if constexpr (HYRISE_DEBUG) {
+    EXPECT_THROW(attribute_vector.get(3), std::exception);
+    EXPECT_THROW(attribute_vector.set(3, ValueID{1}), std::exception);
+    EXPECT_THROW(attribute_vector.set(1, ValueID{65536}), std::exception);
+  }
+}
+
+TEST_F(StorageFixedSizeAttributeVectorTest, Decode) {
+  auto attribute_vector = FixedSizeAttributeVector<uint8_t>{5};
+  for (auto i = size_t{0}; i < 5; ++i) attribute_vector.set(i, ValueID{static_cast<uint32_t>(i * 2)});
+
+  auto value_ids = std::vector<ValueID>(3);
+  attribute_vector.decode(1, 4, value_ids.data());
+  EXPECT_EQ(value_ids, (std::vector<ValueID>{ValueID{2}, ValueID{4}, ValueID{6}}));
+
+  EXPECT_THROW(attribute_vector.decode(3, 6, value_ids.data()), std::exception);
+}
+
+TEST_F(StorageFixedSizeAttributeVectorTest, Width) {
+  EXPECT_EQ(FixedSizeAttributeVector<uint8_t>{1}.width(), 1u);
+  EXPECT_EQ(FixedSizeAttributeVector<uint16_t>{1}.width(), 2u);
+  EXPECT_EQ(FixedSizeAttributeVector<uint32_t>{1}.width(), 4u);
+}
+
+TEST_F(StorageFixedSizeAttributeVectorTest, MemoryUsage) {
+  EXPECT_EQ(FixedSizeAttributeVector<uint8_t>{10}.estimate_memory_usage(), 10u);
+  EXPECT_EQ(FixedSizeAttributeVector<uint16_t>{10}.estimate_memory_usage(), 20u);
+  EXPECT_EQ(FixedSizeAttributeVector<uint32_t>{10}.estimate_memory_usage(), 40u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,131 @@
+#include <array>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/frame_of_reference_segment.hpp"
+#include "../../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceSegmentTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> vc_int = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<int64_t>> vc_long = std::make_shared<ValueSegment<int64_t>>();
+};
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressSegmentInt) {
+  // the first block holds 1'000'000 to 1'000'099, the second one -50 and 100
+  for (auto i = 0; i < 1'024; ++i) vc_int->append(1'000'000 + i % 100);
+  vc_int->append(-50);
+  vc_int->append(NULL_VALUE);
+  vc_int->append(100);
+  const auto for_col = FrameOfReferenceSegment<int32_t>{vc_int};
+
+  EXPECT_EQ(for_col.size(), 1'027u);
+  EXPECT_EQ(for_col.block_count(), 2u);
+  EXPECT_EQ(for_col.block_minima(), (std::vector<int32_t>{1'000'000, -50}));
+  // deltas up to 99 need 7 bits, deltas up to 150 need 8 bits
+  EXPECT_EQ(for_col.bits_per_delta(), (std::vector<uint8_t>{7, 8}));
+  // 1'024 * 7 bits fill 112 words, 2 * 8 bits one more, plus a word of padding
+  EXPECT_EQ(for_col.delta_words().size(), 114u);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1'024; ++chunk_offset) {
+    ASSERT_EQ(for_col.get(chunk_offset), static_cast<int32_t>(1'000'000 + chunk_offset % 100));
+  }
+  EXPECT_EQ(for_col[1'024], AllTypeVariant{-50});
+  EXPECT_TRUE(variant_is_null(for_col[1'025]));
+  EXPECT_FALSE(for_col.is_null(1'026));
+  EXPECT_EQ(for_col[1'026], AllTypeVariant{100});
+
+  auto values = std::array<int32_t, FrameOfReferenceSegment<int32_t>::BLOCK_SIZE>{};
+  for_col.decode_block(0, values.data());
+  EXPECT_EQ(values[9], 1'000'009);
+  EXPECT_EQ(values[1'023], 1'000'023);
+  auto deltas = std::array<uint32_t, FrameOfReferenceSegment<int32_t>::BLOCK_SIZE>{};
+  for_col.decode_deltas(1, deltas.data());
+  EXPECT_EQ(deltas[0], 0u);
+  EXPECT_EQ(deltas[2], 150u);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressSegmentLong) {
+  // the full range of long needs 64 bits per delta, equal values need none
+  vc_long->append(std::numeric_limits<int64_t>::min());
+  vc_long->append(std::numeric_limits<int64_t>::max());
+  vc_long->append(int64_t{0});
+  const auto wide_col = FrameOfReferenceSegment<int64_t>{vc_long};
+  EXPECT_EQ(wide_col.bits_per_delta().front(), 64u);
+  EXPECT_EQ(wide_col[0], AllTypeVariant{std::numeric_limits<int64_t>::min()});
+  EXPECT_EQ(wide_col[1], AllTypeVariant{std::numeric_limits<int64_t>::max()});
+  EXPECT_EQ(wide_col[2], AllTypeVariant{int64_t{0}});
+
+  auto constant_segment = std::make_shared<ValueSegment<int64_t>>();
+  for (auto i = 0; i < 3'000; ++i) constant_segment->append(int64_t{42});
+  const auto constant_col = FrameOfReferenceSegment<int64_t>{constant_segment};
+  EXPECT_EQ(constant_col.bits_per_delta(), (std::vector<uint8_t>{0, 0, 0}));
+  EXPECT_EQ(constant_col.delta_words().size(), 1u);
+  EXPECT_EQ(constant_col[2'999], AllTypeVariant{int64_t{42}});
+  EXPECT_EQ(constant_col.estimate_memory_usage(), 3 * sizeof(int64_t) + 3 + sizeof(uint64_t) + 4 * sizeof(size_t));
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, DecodeDeltasOfAllWidths) {
+  // a full block and a partial one that ends within its second group of 64 deltas, for every delta width
+  const auto test_widths = [](auto type_tag) {
+    using T = decltype(type_tag);
+    using Delta = typename FrameOfReferenceSegment<T>::Delta;
+    constexpr auto BLOCK_SIZE = FrameOfReferenceSegment<T>::BLOCK_SIZE;
+    for (auto bits = size_t{1}; bits <= sizeof(T) * 8; ++bits) {
+      const auto mask = bits == 64 ? ~uint64_t{0} : (uint64_t{1} << bits) - 1;
+      auto value_segment = std::make_shared<ValueSegment<T>>();
+      for (auto index = uint64_t{0}; index < BLOCK_SIZE + 100; ++index) {
+        const auto delta = index % BLOCK_SIZE == 0 ? 0 : index % BLOCK_SIZE == 1 ? mask : index * 0x9E3779B97F4A7C15;
+        value_segment->append(static_cast<T>(static_cast<Delta>(std::numeric_limits<T>::min()) + (delta & mask)));
+      }
+      const auto segment = FrameOfReferenceSegment<T>{value_segment};
+      ASSERT_EQ(segment.bits_per_delta(), (std::vector<uint8_t>(2, bits)));
+
+      auto values = std::array<T, BLOCK_SIZE>{};
+      for (auto block_index = size_t{0}; block_index < 2; ++block_index) {
+        segment.decode_block(block_index, values.data());
+        for (auto index = size_t{0}; index < (block_index == 0 ? BLOCK_SIZE : 100); ++index) {
+          ASSERT_EQ(values[index], value_segment->values()[block_index * BLOCK_SIZE + index]) << bits << " bits";
+        }
+      }
+    }
+  };
+  test_widths(int32_t{});
+  test_widths(int64_t{});
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CreateFromBlocks) {
+  for (auto i = 0; i < 2'000; ++i) vc_int->append(i % 3 == 0 ? NULL_VALUE : AllTypeVariant{i});
+  const auto for_col = FrameOfReferenceSegment<int32_t>{vc_int};
+
+  auto block_minima = for_col.block_minima();
+  auto bits_per_delta = for_col.bits_per_delta();
+  auto delta_words = for_col.delta_words();
+  auto null_bitmap = for_col.null_bitmap();
+  const auto copy = FrameOfReferenceSegment<int32_t>{for_col.size(), std::move(block_minima),
+                                                     std::move(bits_per_delta), std::move(delta_words),
+                                                     std::move(null_bitmap)};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 2'000; ++chunk_offset) {
+    ASSERT_EQ(copy.is_null(chunk_offset), chunk_offset % 3 == 0);
+    if (chunk_offset % 3 != 0) {
+      ASSERT_EQ(copy.get(chunk_offset), static_cast<int32_t>(chunk_offset));
+    }
+  }
+
+  EXPECT_THROW(FrameOfReferenceSegment<int32_t>(10, {1}, {4}, {0}, {}), std::exception);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, Immutable) {
+  vc_int->append(1);
+  auto for_col = FrameOfReferenceSegment<int32_t>{vc_int};
+  EXPECT_THROW(for_col.append(2), std::exception);
+  EXPECT_THROW(FrameOfReferenceSegment<int64_t>{vc_int}, std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,59 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/segment_iterate.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageReferenceSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->append({1, "one"});
+    _table->append({2, "two"});
+    _table->append({3, "three"});
+    _table->compress_chunk(ChunkID{1}, {EncodingType::Dictionary});
+
+    _pos_list = std::make_shared<PosList>(
+        PosList{RowID{ChunkID{1}, 0}, RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}});
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<PosList> _pos_list;
+};
+
+TEST_F(StorageReferenceSegmentTest, AccessValues) {
+  const auto segment = ReferenceSegment{_table, ColumnID{1}, _pos_list};
+  EXPECT_EQ(segment.size(), 4u);
+  EXPECT_EQ(segment[0], AllTypeVariant{"three"});
+  EXPECT_EQ(segment[1], AllTypeVariant{"two"});
+  EXPECT_EQ(segment[2], AllTypeVariant{"one"});
+  EXPECT_EQ(segment.referenced_table(), _table);
+  EXPECT_EQ(segment.referenced_column_id(), ColumnID{1});
+  EXPECT_EQ(segment.pos_list(), _pos_list);
+  EXPECT_EQ(segment.estimate_memory_usage(), 4 * sizeof(RowID));
+}
+
+TEST_F(StorageReferenceSegmentTest, Immutable) {
+  auto segment = ReferenceSegment{_table, ColumnID{0}, _pos_list};
+  EXPECT_THROW(segment.append(4), std::exception);
+}
+
+TEST_F(StorageReferenceSegmentTest, Iterate) {
+  const auto segment = ReferenceSegment{_table, ColumnID{0}, _pos_list};
+  auto values = std::vector<int32_t>{};
+  segment_iterate<int32_t>(segment, [&](const auto& position) {
+    EXPECT_EQ(position.chunk_offset(), values.size());
+    values.emplace_back(position.value());
+  });
+  EXPECT_EQ(values, (std::vector<int32_t>{3, 2, 1, 3}));
+}
+
+}  // namespace opossum
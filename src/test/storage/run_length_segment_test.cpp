@@ -0,0 +1,76 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/run_length_segment.hpp"
+#include "../../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageRunLengthSegmentTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegmentInt) {
+  for (const auto& value : {AllTypeVariant{4}, AllTypeVariant{4}, AllTypeVariant{4}, AllTypeVariant{1}, NULL_VALUE,
+                           NULL_VALUE, AllTypeVariant{4}}) {
+    vc_int->append(value);
+  }
+  const auto rle_col = RunLengthSegment<int>{vc_int};
+
+  EXPECT_EQ(rle_col.size(), 7u);
+  EXPECT_EQ(rle_col.values().size(), 4u);
+  EXPECT_EQ(rle_col.null_values(), (std::vector<bool>{false, false, true, false}));
+  EXPECT_EQ(rle_col.end_positions(), (std::vector<ChunkOffset>{3, 4, 6, 7}));
+
+  EXPECT_EQ(rle_col[0], AllTypeVariant{4});
+  EXPECT_EQ(rle_col[2], AllTypeVariant{4});
+  EXPECT_EQ(rle_col[3], AllTypeVariant{1});
+  EXPECT_TRUE(variant_is_null(rle_col[5]));
+  EXPECT_EQ(rle_col[6], AllTypeVariant{4});
+  EXPECT_EQ(rle_col.run_index(5), 2u);
+
+  // four runs of a value, a NULL flag, and an end position
+  EXPECT_EQ(rle_col.estimate_memory_usage(), 4 * sizeof(int) + 1 + 4 * sizeof(ChunkOffset));
+}
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegmentString) {
+  for (auto i = 0; i < 1'000; ++i) vc_str->append(std::to_string(i / 100));
+  const auto rle_col = RunLengthSegment<std::string>{vc_str};
+
+  EXPECT_EQ(rle_col.size(), 1'000u);
+  EXPECT_EQ(rle_col.values().size(), 10u);
+  EXPECT_EQ(rle_col[999], AllTypeVariant{"9"});
+  EXPECT_EQ(rle_col[100], AllTypeVariant{"1"});
+  EXPECT_EQ(rle_col[99], AllTypeVariant{"0"});
+}
+
+TEST_F(StorageRunLengthSegmentTest, CreateFromRuns) {
+  const auto rle_col = RunLengthSegment<int>{{2, 0, 3}, {false, true, false}, {2, 5, 6}};
+  EXPECT_EQ(rle_col.size(), 6u);
+  EXPECT_EQ(rle_col[1], AllTypeVariant{2});
+  EXPECT_TRUE(variant_is_null(rle_col[2]));
+  EXPECT_EQ(rle_col[5], AllTypeVariant{3});
+
+  EXPECT_EQ(RunLengthSegment<int>({}, {}, {}).size(), 0u);
+  EXPECT_THROW(RunLengthSegment<int>({1, 2}, {false}, {1, 2}), std::exception);
+}
+
+TEST_F(StorageRunLengthSegmentTest, Immutable) {
+  vc_int->append(1);
+  auto rle_col = RunLengthSegment<int>{vc_int};
+  EXPECT_THROW(rle_col.append(2), std::exception);
+}
+
+TEST_F(StorageRunLengthSegmentTest, RequiresValueSegmentOfSameType) {
+  vc_int->append(1);
+  EXPECT_THROW(RunLengthSegment<std::string>{vc_int}, std::exception);
+  EXPECT_THROW(RunLengthSegment<int>{std::make_shared<RunLengthSegment<int>>(vc_int)}, std::exception);
+}
+
+}  // namespace opossum
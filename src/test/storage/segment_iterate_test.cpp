@@ -0,0 +1,91 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/frame_of_reference_segment.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/segment_iterate.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageSegmentIterateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    value_segment = std::make_shared<ValueSegment<std::string>>();
+    for (auto i = 0; i < 3000; ++i) {
+      value_segment->append(std::to_string(i % 7));
+    }
+    dictionary_segment = std::make_shared<DictionarySegment<std::string>>(value_segment);
+    run_length_segment = std::make_shared<RunLengthSegment<std::string>>(value_segment);
+  }
+
+  std::shared_ptr<ValueSegment<std::string>> value_segment;
+  std::shared_ptr<DictionarySegment<std::string>> dictionary_segment;
+  std::shared_ptr<RunLengthSegment<std::string>> run_length_segment;
+};
+
+TEST_F(StorageSegmentIterateTest, ResolveSegmentType) {
+  auto resolved_value_segment = false;
+  resolve_segment_type<std::string>(*value_segment, [&](const auto& typed_segment) {
+    resolved_value_segment = std::is_same_v<std::decay_t<decltype(typed_segment)>, ValueSegment<std::string>>;
+  });
+  EXPECT_TRUE(resolved_value_segment);
+
+  auto resolved_dictionary_segment = false;
+  resolve_segment_type<std::string>(*dictionary_segment, [&](const auto& typed_segment) {
+    resolved_dictionary_segment =
+        std::is_same_v<std::decay_t<decltype(typed_segment)>, DictionarySegment<std::string>>;
+  });
+  EXPECT_TRUE(resolved_dictionary_segment);
+
+  auto resolved_run_length_segment = false;
+  resolve_segment_type<std::string>(*run_length_segment, [&](const auto& typed_segment) {
+    resolved_run_length_segment =
+        std::is_same_v<std::decay_t<decltype(typed_segment)>, RunLengthSegment<std::string>>;
+  });
+  EXPECT_TRUE(resolved_run_length_segment);
+
+  EXPECT_THROW(resolve_segment_type<int32_t>(*value_segment, [](const auto&) {}), std::exception);
+}
+
+TEST_F(StorageSegmentIterateTest, IterateEncodedSegments) {
+  for (const auto& segment :
+       std::vector<std::shared_ptr<BaseSegment>>{value_segment, dictionary_segment, run_length_segment}) {
+    auto expected_chunk_offset = ChunkOffset{0};
+    segment_iterate<std::string>(*segment, [&](const auto& position) {
+      EXPECT_EQ(position.chunk_offset(), expected_chunk_offset);
+      EXPECT_EQ(position.value(), std::to_string(expected_chunk_offset % 7));
+      EXPECT_FALSE(position.is_null());
+      ++expected_chunk_offset;
+    });
+    EXPECT_EQ(expected_chunk_offset, 3000u);
+  }
+}
+
+TEST_F(StorageSegmentIterateTest, IterateIntegerSegmentsWithNulls) {
+  auto int_segment = std::make_shared<ValueSegment<int32_t>>();
+  for (auto i = 0; i < 3'000; ++i) int_segment->append(i / 10 == 3 ? NULL_VALUE : AllTypeVariant{i / 10});
+
+  for (const auto& segment : std::vector<std::shared_ptr<BaseSegment>>{
+           std::make_shared<RunLengthSegment<int32_t>>(int_segment),
+           std::make_shared<FrameOfReferenceSegment<int32_t>>(int_segment)}) {
+    auto expected_chunk_offset = ChunkOffset{0};
+    segment_iterate<int32_t>(*segment, [&](const auto& position) {
+      EXPECT_EQ(position.chunk_offset(), expected_chunk_offset);
+      EXPECT_EQ(position.is_null(), expected_chunk_offset / 10 == 3);
+      if (!position.is_null()) {
+        EXPECT_EQ(position.value(), static_cast<int32_t>(expected_chunk_offset / 10));
+      }
+      ++expected_chunk_offset;
+    });
+    EXPECT_EQ(expected_chunk_offset, 3'000u);
+  }
+}
+
+}  // namespace opossum
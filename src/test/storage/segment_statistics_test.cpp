@@ -0,0 +1,85 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/dictionary_segment.hpp"
+#include "../../lib/storage/frame_of_reference_segment.hpp"
+#include "../../lib/storage/reference_segment.hpp"
+#include "../../lib/storage/run_length_segment.hpp"
+#include "../../lib/storage/segment_statistics.hpp"
+#include "../../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageSegmentStatisticsTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    for (const auto value : {7, 3, 7, 9, 3}) vc_int->append(value);
+    vc_int->append(NULL_VALUE);
+    vc_int->append(NULL_VALUE);
+  }
+
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+};
+
+TEST_F(StorageSegmentStatisticsTest, ValueSegment) {
+  const auto statistics = compute_segment_statistics(DataType::Int, *vc_int);
+  EXPECT_EQ(statistics.min, AllTypeVariant{3});
+  EXPECT_EQ(statistics.max, AllTypeVariant{9});
+  EXPECT_EQ(statistics.distinct_count, 3u);
+  EXPECT_EQ(statistics.null_count, 2u);
+}
+
+TEST_F(StorageSegmentStatisticsTest, DictionarySegment) {
+  const auto statistics = compute_segment_statistics(DataType::Int, DictionarySegment<int>{vc_int});
+  EXPECT_EQ(statistics.min, AllTypeVariant{3});
+  EXPECT_EQ(statistics.max, AllTypeVariant{9});
+  EXPECT_EQ(statistics.distinct_count, 3u);
+  EXPECT_EQ(statistics.null_count, 2u);
+
+  // values of a shared dictionary that do not occur in the segment are not taken into account
+  const auto dictionary = std::make_shared<const std::vector<int>>(std::vector<int>{1, 3, 5, 7, 9, 11});
+  const auto shared_statistics = compute_segment_statistics(DataType::Int, DictionarySegment<int>{vc_int, dictionary});
+  EXPECT_EQ(shared_statistics.min, AllTypeVariant{3});
+  EXPECT_EQ(shared_statistics.max, AllTypeVariant{9});
+  EXPECT_EQ(shared_statistics.distinct_count, 3u);
+}
+
+TEST_F(StorageSegmentStatisticsTest, RunLengthSegment) {
+  const auto statistics = compute_segment_statistics(DataType::Int, RunLengthSegment<int>{vc_int});
+  EXPECT_EQ(statistics.min, AllTypeVariant{3});
+  EXPECT_EQ(statistics.max, AllTypeVariant{9});
+  EXPECT_EQ(statistics.distinct_count, 3u);
+  EXPECT_EQ(statistics.null_count, 2u);
+}
+
+TEST_F(StorageSegmentStatisticsTest, FrameOfReferenceSegment) {
+  const auto statistics = compute_segment_statistics(DataType::Int, FrameOfReferenceSegment<int>{vc_int});
+  EXPECT_EQ(statistics.min, AllTypeVariant{3});
+  EXPECT_EQ(statistics.max, AllTypeVariant{9});
+  EXPECT_EQ(statistics.distinct_count, 3u);
+  EXPECT_EQ(statistics.null_count, 2u);
+}
+
+TEST_F(StorageSegmentStatisticsTest, NullsOnly) {
+  auto vc_str = std::make_shared<ValueSegment<std::string>>();
+  vc_str->append(NULL_VALUE);
+  for (const auto& segment : std::vector<std::shared_ptr<BaseSegment>>{
+           vc_str, std::make_shared<DictionarySegment<std::string>>(vc_str),
+           std::make_shared<RunLengthSegment<std::string>>(vc_str)}) {
+    const auto statistics = compute_segment_statistics(DataType::String, *segment);
+    EXPECT_TRUE(variant_is_null(statistics.min));
+    EXPECT_TRUE(variant_is_null(statistics.max));
+    EXPECT_EQ(statistics.distinct_count, 0u);
+    EXPECT_EQ(statistics.null_count, 1u);
+  }
+}
+
+TEST_F(StorageSegmentStatisticsTest, ReferenceSegment) {
+  const auto reference_segment = ReferenceSegment{nullptr, ColumnID{0}, std::make_shared<PosList>()};
+  EXPECT_THROW(compute_segment_statistics(DataType::Int, reference_segment), std::exception);
+}
+
+}  // namespace opossum
@@ -1,4 +1,5 @@
 #include <memory>
+#include <sstream>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -45,6 +46,52 @@ TEST_F(StorageStorageManagerTest, DoesNotHaveTable) {
   EXPECT_EQ(sm.has_table("third_table"), false);
 }
 
+TEST_F(StorageStorageManagerTest, SegmentMemoryUsages) {
+  auto& sm = StorageManager::get();
+  auto table = sm.get_table("second_table");
+  table->add_column("a", "int");
+  table->add_column("b", "long");
+  for (auto value = 0; value < 6; ++value) table->append({value, int64_t{value}});
+  table->compress_chunk(ChunkID{0}, {EncodingType::Dictionary});
+
+  const auto memory_usages = sm.segment_memory_usages();
+  // first_table has no columns and therefore no segments
+  ASSERT_EQ(memory_usages.size(), 4u);
+  EXPECT_EQ(memory_usages[0].table_name, "second_table");
+  EXPECT_EQ(memory_usages[0].column_id, ColumnID{0});
+  EXPECT_EQ(memory_usages[0].chunk_id, ChunkID{0});
+  EXPECT_EQ(memory_usages[0].encoding, "Dictionary");
+  EXPECT_EQ(memory_usages[0].row_count, 4u);
+  EXPECT_EQ(memory_usages[0].memory_usage, 4 * sizeof(int32_t) + 8);
+  EXPECT_EQ(memory_usages[1].encoding, "Value");
+  EXPECT_EQ(memory_usages[1].row_count, 2u);
+  // the storage of value segments and their null bitmaps is allocated upfront for the target chunk size
+  EXPECT_EQ(memory_usages[1].memory_usage, 4 * sizeof(int32_t) + sizeof(uint64_t));
+  EXPECT_EQ(memory_usages[3].column_id, ColumnID{1});
+  EXPECT_EQ(memory_usages[3].memory_usage, 4 * sizeof(int64_t) + sizeof(uint64_t));
+
+  // segments that are left unencoded when their chunk is compressed no longer hold the storage allocated upfront
+  table->compress_chunk(ChunkID{1}, {EncodingType::Unencoded});
+  EXPECT_EQ(sm.segment_memory_usages()[1].memory_usage, 2 * sizeof(int32_t));
+  EXPECT_EQ(sm.segment_memory_usages()[3].memory_usage, 2 * sizeof(int64_t));
+}
+
+TEST_F(StorageStorageManagerTest, PrintMemoryUsage) {
+  auto& sm = StorageManager::get();
+  auto table = sm.get_table("second_table");
+  table->add_column("a", "int");
+  table->append({1});
+
+  auto output = std::stringstream{};
+  sm.print_memory_usage(output);
+  EXPECT_EQ(output.str(),
+            "2 tables available:\n"
+            " - \"first_table\" [memory_usage=0]\n"
+            " - \"second_table\" [memory_usage=24]\n"
+            "   - column \"a\" (int) [memory_usage=24]\n"
+            "     - chunk 0 [encoding=Value, row_count=1, memory_usage=24]\n");
+}
+
 TEST_F(StorageStorageManagerTest, HasTable) {
   auto& sm = StorageManager::get();
   EXPECT_EQ(sm.has_table("first_table"), true);
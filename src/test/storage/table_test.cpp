@@ -1,6 +1,8 @@
 #include <limits>
 #include <memory>
+#include <memory_resource>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -8,7 +10,12 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/frame_of_reference_segment.hpp"
+#include "../lib/storage/global_dictionary.hpp"
+#include "../lib/storage/run_length_segment.hpp"
 #include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
 
 namespace opossum {
 
@@ -68,13 +75,23 @@ TEST_F(StorageTableTest, GetColumnNames) {
 }
 
 TEST_F(StorageTableTest, GetColumnType) {
-  EXPECT_EQ(t.column_type(ColumnID{0}), "int");
-  EXPECT_EQ(t.column_type(ColumnID{1}), "string");
+  EXPECT_EQ(t.column_type(ColumnID{0}), DataType::Int);
+  EXPECT_EQ(t.column_type(ColumnID{1}), DataType::String);
   if constexpr (HYRISE_DEBUG) {
     EXPECT_THROW(t.column_type(ColumnID{2}), std::exception);
   }
 }
 
+TEST_F(StorageTableTest, AddColumnByDataType) {
+  t.add_column("col_3", DataType::Double);
+  EXPECT_EQ(t.column_type(ColumnID{2}), DataType::Double);
+  EXPECT_THROW(t.add_column("col_4", "decimal"), std::exception);
+  EXPECT_EQ(t.column_count(), 3u);
+
+  t.append({4, "Hello,", 0.5});
+  EXPECT_THROW(t.add_column("col_4", DataType::Int), std::exception);
+}
+
 TEST_F(StorageTableTest, GetColumnIdByName) {
   EXPECT_EQ(t.column_id_by_name("col_2"), 1u);
   EXPECT_THROW(t.column_id_by_name("no_column_name"), std::exception);
@@ -82,4 +99,327 @@ TEST_F(StorageTableTest, GetColumnIdByName) {
 
 TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t.target_chunk_size(), 2u); }
 
+TEST_F(StorageTableTest, EmplaceChunk) {
+  auto chunk = std::make_unique<Chunk>();
+  chunk->add_segment(std::make_shared<ValueSegment<int32_t>>(std::pmr::vector<int32_t>{1, 2}));
+  chunk->add_segment(std::make_shared<ValueSegment<std::string>>(std::pmr::vector<std::string>{"a", "b"}));
+
+  // the initial empty chunk is replaced
+  t.emplace_chunk(std::move(chunk));
+  EXPECT_EQ(t.chunk_count(), 1u);
+  EXPECT_EQ(t.row_count(), 2u);
+
+  chunk = std::make_unique<Chunk>();
+  chunk->add_segment(std::make_shared<ValueSegment<int32_t>>(std::pmr::vector<int32_t>{3}));
+  chunk->add_segment(std::make_shared<ValueSegment<std::string>>(std::pmr::vector<std::string>{"c"}));
+  t.emplace_chunk(std::move(chunk));
+  EXPECT_EQ(t.chunk_count(), 2u);
+  EXPECT_EQ(t.row_count(), 3u);
+}
+
+TEST_F(StorageTableTest, CompressChunk) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  const auto uncompressed_chunk = t.get_chunk(ChunkID{0});
+  t.compress_chunk(ChunkID{0}, {EncodingType::Dictionary});
+
+  // readers that got the chunk before it was replaced can still use it
+  EXPECT_EQ(uncompressed_chunk->size(), 2u);
+  EXPECT_EQ((*uncompressed_chunk->get_segment(ColumnID{1}))[1], AllTypeVariant{"world"});
+
+  const auto compressed_chunk = t.get_chunk(ChunkID{0});
+  EXPECT_NE(compressed_chunk, uncompressed_chunk);
+  EXPECT_EQ(compressed_chunk->size(), 2u);
+  EXPECT_EQ(compressed_chunk->column_count(), 2u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(compressed_chunk->get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(compressed_chunk->get_segment(ColumnID{1})));
+  EXPECT_EQ((*compressed_chunk->get_segment(ColumnID{0}))[1], AllTypeVariant{6});
+  EXPECT_EQ((*compressed_chunk->get_segment(ColumnID{1}))[0], AllTypeVariant{"Hello,"});
+  EXPECT_EQ(t.row_count(), 3u);
+
+  // an already compressed chunk cannot be compressed again
+  EXPECT_THROW(t.compress_chunk(ChunkID{0}), std::exception);
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(t.get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+}
+
+TEST_F(StorageTableTest, CompressChunkWithEncodingSpec) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  t.compress_chunk(ChunkID{0}, {EncodingType::FrameOfReference, EncodingType::RunLength});
+  const auto chunk_0 = t.get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<FrameOfReferenceSegment<int32_t>>(chunk_0->get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<std::string>>(chunk_0->get_segment(ColumnID{1})));
+  EXPECT_EQ((*chunk_0->get_segment(ColumnID{0}))[1], AllTypeVariant{6});
+  EXPECT_EQ((*chunk_0->get_segment(ColumnID{1}))[0], AllTypeVariant{"Hello,"});
+
+  // a single encoding applies to all columns, unencoded chunks still get their statistics
+  t.compress_chunk(ChunkID{1}, {EncodingType::Unencoded});
+  const auto chunk_1 = t.get_chunk(ChunkID{1});
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(chunk_1->get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<std::string>>(chunk_1->get_segment(ColumnID{1})));
+  EXPECT_TRUE(chunk_1->statistics());
+  // unencoded segments are copied, so that they no longer hold the storage allocated upfront for the whole chunk
+  EXPECT_EQ(chunk_1->get_segment(ColumnID{0})->estimate_memory_usage(), sizeof(int32_t));
+  EXPECT_EQ((*chunk_1->get_segment(ColumnID{1}))[0], AllTypeVariant{"!"});
+
+  // FrameOfReference encoding is limited to int and long columns
+  EXPECT_THROW(t.compress_chunk(ChunkID{1}, {EncodingType::FrameOfReference}), std::exception);
+  const auto too_many_encodings =
+      ChunkEncodingSpec{EncodingType::Dictionary, EncodingType::Dictionary, EncodingType::Dictionary};
+  EXPECT_THROW(t.compress_chunk(ChunkID{1}, too_many_encodings), std::exception);
+  EXPECT_THROW(t.compress_chunk(ChunkID{1}, {EncodingType::RunLength, EncodingType::Unencoded},
+                                {nullptr, std::make_shared<GlobalDictionary<std::string>>(std::vector<std::string>{})}),
+               std::exception);
+}
+
+TEST_F(StorageTableTest, CompressChunkAutomatically) {
+  auto table = Table{10'000};
+  table.add_column("sorted", "int");
+  table.add_column("category", "string");
+  table.add_column("unique", "double");
+  for (auto i = 0; i < 10'000; ++i) {
+    table.append({i / 100, "category_" + std::to_string(i % 7), i * 1.25});
+  }
+
+  table.compress_chunk(ChunkID{0});
+  const auto chunk = table.get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(chunk->get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk->get_segment(ColumnID{1})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<double>>(chunk->get_segment(ColumnID{2})));
+  EXPECT_EQ((*chunk->get_segment(ColumnID{0}))[9'999], AllTypeVariant{99});
+}
+
+TEST_F(StorageTableTest, CompressChunkWithGlobalDictionary) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  t.append({5, "Hello,"});
+  const auto dictionary =
+      std::make_shared<GlobalDictionary<std::string>>(std::vector<std::string>{"world", "Hello,", "!", "unused"});
+  t.compress_chunk(ChunkID{0}, {nullptr, dictionary});
+  t.compress_chunk(ChunkID{1}, {nullptr, dictionary});
+
+  // both chunks share the dictionary of the second column, the first column has its own dictionaries
+  const auto& segment_0 = static_cast<const DictionarySegment<std::string>&>(
+      *t.get_chunk(ChunkID{0})->get_segment(ColumnID{1}));
+  const auto& segment_1 = static_cast<const DictionarySegment<std::string>&>(
+      *t.get_chunk(ChunkID{1})->get_segment(ColumnID{1}));
+  EXPECT_EQ(segment_0.dictionary(), dictionary->values());
+  EXPECT_EQ(segment_1.dictionary(), dictionary->values());
+  EXPECT_EQ(*dictionary->values(), (std::vector<std::string>{"!", "Hello,", "unused", "world"}));
+  EXPECT_EQ(segment_0.attribute_vector()->get(0), segment_1.attribute_vector()->get(1));
+  EXPECT_EQ((*t.get_chunk(ChunkID{1})->get_segment(ColumnID{0}))[1], AllTypeVariant{5});
+
+  // the dictionary has to match the type of the column and contain all of its values
+  t.append({1, "missing"});
+  EXPECT_THROW(t.compress_chunk(ChunkID{2}, {dictionary, nullptr}), std::exception);
+  EXPECT_THROW(t.compress_chunk(ChunkID{2}, {nullptr, dictionary}), std::exception);
+  EXPECT_THROW(t.compress_chunk(ChunkID{2}, {dictionary}), std::exception);
+}
+
+TEST_F(StorageTableTest, Statistics) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, NULL_VALUE});
+  // the statistics are only computed when a chunk is compressed, not when it is full
+  EXPECT_FALSE(t.get_chunk(ChunkID{0})->statistics());
+
+  t.compress_chunk(ChunkID{0}, {EncodingType::Unencoded});
+  const auto statistics = t.get_chunk(ChunkID{0})->statistics();
+  ASSERT_TRUE(statistics);
+  EXPECT_EQ((*statistics)[0].min, AllTypeVariant{4});
+  EXPECT_EQ((*statistics)[0].max, AllTypeVariant{6});
+  EXPECT_EQ((*statistics)[1].min, AllTypeVariant{"Hello,"});
+  EXPECT_EQ((*statistics)[1].distinct_count, 2u);
+  EXPECT_FALSE(t.get_chunk(ChunkID{1})->statistics());
+
+  t.compress_chunk(ChunkID{1}, {EncodingType::Dictionary});
+  const auto compressed_statistics = t.get_chunk(ChunkID{1})->statistics();
+  ASSERT_TRUE(compressed_statistics);
+  EXPECT_EQ((*compressed_statistics)[0].max, AllTypeVariant{3});
+  EXPECT_EQ((*compressed_statistics)[1].null_count, 1u);
+
+  // emplaced chunks only get statistics if they are already compressed
+  auto table = Table{2};
+  table.add_column("a", "int");
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>(std::pmr::vector<int32_t>{1, 2});
+  for (const auto& segment : std::vector<std::shared_ptr<BaseSegment>>{
+           value_segment, std::make_shared<DictionarySegment<int32_t>>(value_segment)}) {
+    auto chunk = std::make_unique<Chunk>();
+    chunk->add_segment(segment);
+    table.emplace_chunk(std::move(chunk));
+  }
+  EXPECT_FALSE(table.get_chunk(ChunkID{0})->statistics());
+  ASSERT_TRUE(table.get_chunk(ChunkID{1})->statistics());
+  EXPECT_EQ((*table.get_chunk(ChunkID{1})->statistics())[0].max, AllTypeVariant{2});
+
+  // neither do chunks filled concurrently
+  auto concurrent_table = Table{2};
+  concurrent_table.add_column("a", "int");
+  for (auto i = 0; i < 3; ++i) concurrent_table.append_concurrently({i});
+  EXPECT_FALSE(concurrent_table.get_chunk(ChunkID{0})->statistics());
+}
+
+TEST_F(StorageTableTest, AppendConcurrently) {
+  constexpr auto thread_count = 8;
+  constexpr auto rows_per_thread = 5'000;
+  auto table = Table{1'000};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+
+  auto writers = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < thread_count; ++thread_id) {
+    writers.emplace_back([&, thread_id] {
+      for (auto row_id = 0; row_id < rows_per_thread; ++row_id) {
+        const auto value = thread_id * rows_per_thread + row_id;
+        table.append_concurrently({value, std::to_string(value)});
+      }
+    });
+  }
+
+  // readers always see complete rows, and the row count never decreases
+  auto previous_row_count = uint64_t{0};
+  while (previous_row_count < thread_count * rows_per_thread) {
+    const auto row_count = table.row_count();
+    ASSERT_GE(row_count, previous_row_count);
+    previous_row_count = row_count;
+
+    const auto chunk = table.get_chunk(ChunkID{static_cast<uint32_t>(table.chunk_count() - 1)});
+    const auto size = chunk->size();
+    if (size > 0) {
+      const auto value = type_cast<int32_t>((*chunk->get_segment(ColumnID{0}))[size - 1]);
+      ASSERT_EQ((*chunk->get_segment(ColumnID{1}))[size - 1], AllTypeVariant{std::to_string(value)});
+    }
+  }
+  for (auto& writer : writers) writer.join();
+
+  EXPECT_EQ(table.row_count(), uint64_t{thread_count * rows_per_thread});
+  EXPECT_EQ(table.chunk_count(), 40u);
+  auto seen_values = std::vector<bool>(thread_count * rows_per_thread);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    ASSERT_EQ(chunk->size(), 1'000u);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      const auto value = type_cast<int32_t>((*chunk->get_segment(ColumnID{0}))[chunk_offset]);
+      EXPECT_EQ((*chunk->get_segment(ColumnID{1}))[chunk_offset], AllTypeVariant{std::to_string(value)});
+      EXPECT_FALSE(seen_values[value]);
+      seen_values[value] = true;
+    }
+  }
+}
+
+TEST_F(StorageTableTest, AppendConcurrentlyToLargeChunks) {
+  // the storage of chunks is allocated upfront for a limited number of rows only
+  auto table = Table{};
+  table.add_column("a", "long");
+  for (auto value = int64_t{0}; value < 70'000; ++value) {
+    table.append_concurrently({value});
+  }
+  EXPECT_EQ(table.chunk_count(), 2u);
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->size(), 65'535u);
+  EXPECT_EQ((*table.get_chunk(ChunkID{1})->get_segment(ColumnID{0}))[0], AllTypeVariant{int64_t{65'535}});
+
+  EXPECT_THROW(table.append_concurrently({1}), std::exception);
+  EXPECT_EQ(table.row_count(), 70'000u);
+}
+
+TEST_F(StorageTableTest, InitialChunkIsAllocatedOnFirstAppend) {
+  // adding columns does not allocate any storage, as the rows might be added by emplace_chunk()
+  auto table = Table{100};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->capacity(), 0u);
+  EXPECT_EQ(table.memory_usage(), 0u);
+
+  table.append({1, "a"});
+  EXPECT_EQ(table.chunk_count(), 1u);
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->capacity(), 100u);
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->size(), 1u);
+}
+
+TEST_F(StorageTableTest, PreallocatedChunks) {
+  auto table = Table{100};
+  table.add_column("a", "int");
+  table.add_column("b", "long");
+  for (auto value = 0; value < 150; ++value) {
+    table.append({value, int64_t{value}});
+  }
+  ASSERT_EQ(table.chunk_count(), 2u);
+
+  // the segments of appended chunks share a single buffer, in which they are placed one after another, each followed by
+  // its null bitmap
+  const auto chunk = table.get_chunk(ChunkID{1});
+  EXPECT_EQ(chunk->capacity(), 100u);
+  const auto& int_segment = static_cast<const ValueSegment<int32_t>&>(*chunk->get_segment(ColumnID{0}));
+  const auto& long_segment = static_cast<const ValueSegment<int64_t>&>(*chunk->get_segment(ColumnID{1}));
+  const auto int_address = reinterpret_cast<uintptr_t>(int_segment.values().data());
+  const auto long_address = reinterpret_cast<uintptr_t>(long_segment.values().data());
+  EXPECT_EQ(long_address - int_address, 100 * sizeof(int32_t) + 2 * sizeof(uint64_t));
+  EXPECT_EQ(long_segment.values()[49], 149);
+
+  // appending does not reallocate the storage
+  table.append({150, int64_t{150}});
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(long_segment.values().data()), long_address);
+  EXPECT_EQ(long_segment.capacity(), 100u);
+}
+
+TEST_F(StorageTableTest, NoPreallocationForLargeChunks) {
+  auto table = Table{};
+  table.add_column("a", "int");
+  table.append({1});
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->capacity(), 0u);
+  EXPECT_EQ(table.memory_usage(), sizeof(int32_t));
+}
+
+TEST_F(StorageTableTest, MemoryUsage) {
+  // The storage of chunks, including a null bitmap word per segment, is allocated upfront for the target chunk size.
+  // For the initial chunk, this happens on the first append.
+  EXPECT_EQ(t.memory_usage(), 0);
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  EXPECT_EQ(t.memory_usage(), 4 * sizeof(int32_t) + 4 * sizeof(std::string) + 4 * sizeof(uint64_t));
+
+  // the compressed chunk holds two dictionaries with two entries each and two bit-packed attribute vectors of one word
+  t.compress_chunk(ChunkID{0}, {EncodingType::Dictionary});
+  EXPECT_EQ(t.memory_usage(), 4 * sizeof(int32_t) + 4 * sizeof(std::string) + 4 * sizeof(uint64_t));
+}
+
+TEST_F(StorageTableTest, MemoryUsageCountsSharedDictionariesOnce) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  for (auto value = 0; value < 30; ++value) table->append({value % 20});
+  const auto dictionary = build_global_dictionary({{table, ColumnID{0}}});
+  for (auto chunk_id = ChunkID{0}; chunk_id < 3; ++chunk_id) table->compress_chunk(chunk_id, {dictionary});
+
+  // the dictionary of 20 values is counted once, next to three attribute vectors of ten one-byte value ids
+  EXPECT_EQ(table->memory_usage(), 20 * sizeof(int32_t) + 3 * 10);
+  EXPECT_EQ(table->column_memory_usage(ColumnID{0}), 20 * sizeof(int32_t) + 3 * 10);
+  // each segment reports the dictionary it references
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->get_segment(ColumnID{0})->estimate_memory_usage(), 20 * sizeof(int32_t) + 10);
+}
+
+TEST_F(StorageTableTest, UnorderedComparisonWithNulls) {
+  // the rows of two tables with NULLs are compared regardless of their order
+  auto left = Table{};
+  auto right = Table{};
+  for (auto* table : {&left, &right}) {
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+  }
+  left.append({2, "x"});
+  left.append({NULL_VALUE, "y"});
+  left.append({1, NULL_VALUE});
+  left.append({NULL_VALUE, NULL_VALUE});
+  right.append({NULL_VALUE, NULL_VALUE});
+  right.append({1, NULL_VALUE});
+  right.append({NULL_VALUE, "y"});
+  right.append({2, "x"});
+
+  EXPECT_TRUE(_table_equal(left, right));
+  EXPECT_TRUE(_table_equal(right, left));
+}
+
 }  // namespace opossum
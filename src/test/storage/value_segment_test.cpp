@@ -74,11 +74,95 @@ TEST_F(StorageValueSegmentTest, GetValues) {
   EXPECT_EQ(type_cast<int>(values[2]), 2);
 }
 
-// TEST_F(StorageValueSegmentTest, MemoryUsage) {
-//   int_value_segment.append(1);
-//   EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{4});
-//   int_value_segment.append(2);
-//   EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{8});
-// }
+TEST_F(StorageValueSegmentTest, PreallocatedValues) {
+  auto segment = ValueSegment<int32_t>{ChunkOffset{3}};
+  EXPECT_EQ(segment.capacity(), 3u);
+  EXPECT_EQ(segment.size(), 0u);
+
+  // written values become visible only once they are published
+  segment.write_reserved(ChunkOffset{1}, 7);
+  segment.write_reserved(ChunkOffset{0}, 5);
+  EXPECT_EQ(segment.size(), 0u);
+  segment.publish(ChunkOffset{2});
+  EXPECT_EQ(segment.size(), 2u);
+  EXPECT_EQ(segment.values()[1], 7);
+
+  segment.append(9);
+  segment.append(11);
+  EXPECT_EQ(segment.size(), 4u);
+  EXPECT_EQ(segment.values().back(), 11);
+  EXPECT_EQ(segment[2], AllTypeVariant{9});
+
+  EXPECT_TRUE(segment.matches_data_type(1));
+  EXPECT_FALSE(segment.matches_data_type(1.0));
+  EXPECT_FALSE(segment.matches_data_type("1"));
+}
+
+TEST_F(StorageValueSegmentTest, PreallocatedStrings) {
+  // only the written strings are constructed, the storage allocated upfront is estimated as a whole
+  auto segment = ValueSegment<std::string>{ChunkOffset{2}};
+  EXPECT_EQ(segment.estimate_memory_usage(), 2 * sizeof(std::string) + sizeof(uint64_t));
+  segment.write_reserved(ChunkOffset{0}, "Hello");
+  segment.write_reserved(ChunkOffset{1}, NULL_VALUE);
+  segment.discard_reserved(ChunkOffset{1});
+  EXPECT_EQ(segment.null_bitmap_word(0), 0u);
+  segment.write_reserved(ChunkOffset{1}, "world");
+  segment.publish(ChunkOffset{2});
+
+  // once the storage allocated upfront is full, the values are moved to storage that can grow
+  segment.append(std::string(100, 'x'));
+  EXPECT_EQ(segment.size(), 3u);
+  EXPECT_EQ(segment[0], AllTypeVariant{"Hello"});
+  EXPECT_EQ(segment.values()[1], "world");
+  EXPECT_EQ(segment.estimate_memory_usage(), 3 * sizeof(std::string) + 101 + sizeof(uint64_t));
+}
+
+TEST_F(StorageValueSegmentTest, Nulls) {
+  int_value_segment.append(1);
+  EXPECT_EQ(int_value_segment.null_bitmap_word(0), 0u);
+
+  for (auto i = 0; i < 100; ++i) int_value_segment.append(i % 3 == 0 ? NULL_VALUE : AllTypeVariant{i});
+  EXPECT_EQ(int_value_segment.size(), 101u);
+  EXPECT_FALSE(int_value_segment.is_null(0));
+  EXPECT_TRUE(int_value_segment.is_null(1));
+  EXPECT_FALSE(int_value_segment.is_null(2));
+  EXPECT_TRUE(int_value_segment.is_null(100));
+  EXPECT_TRUE(variant_is_null(int_value_segment[1]));
+  EXPECT_EQ(int_value_segment[2], AllTypeVariant{1});
+  EXPECT_EQ(int_value_segment.null_bitmap_word(2), 0u);
+
+  // the bitmap is allocated when the first NULL is appended and grows with the segment
+  EXPECT_EQ(int_value_segment.estimate_memory_usage(), 101 * sizeof(int) + 2 * sizeof(uint64_t));
+
+  EXPECT_TRUE(int_value_segment.matches_data_type(NULL_VALUE));
+  auto segment = ValueSegment<std::string>{ChunkOffset{70}};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 66; ++chunk_offset) {
+    segment.write_reserved(chunk_offset, chunk_offset == 65 ? NULL_VALUE : AllTypeVariant{"a"});
+  }
+  segment.publish(ChunkOffset{66});
+  EXPECT_FALSE(segment.is_null(0));
+  EXPECT_TRUE(segment.is_null(65));
+  EXPECT_EQ(segment.null_bitmap_word(1), uint64_t{1} << 1);
+}
+
+TEST_F(StorageValueSegmentTest, MemoryUsage) {
+  int_value_segment.append(1);
+  EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{4});
+  int_value_segment.append(2);
+  EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{8});
+}
+
+TEST_F(StorageValueSegmentTest, StringMemoryUsage) {
+  // short strings are stored inside the string object
+  string_value_segment.append("Hello");
+  EXPECT_EQ(string_value_segment.estimate_memory_usage(), sizeof(std::string));
+
+  // long strings additionally allocate their characters on the heap
+  const auto long_string = std::string(100, 'x');
+  string_value_segment.append(long_string);
+  const auto& stored_string = string_value_segment.values().back();
+  EXPECT_EQ(string_value_segment.estimate_memory_usage(), 2 * sizeof(std::string) + stored_string.capacity() + 1);
+  EXPECT_GE(string_value_segment.estimate_memory_usage(), 2 * sizeof(std::string) + 101);
+}
 
 }  // namespace opossum
@@ -0,0 +1,223 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/frame_of_reference_segment.hpp"
+#include "../lib/storage/global_dictionary.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/utils/binary_table_io.hpp"
+
+namespace opossum {
+
+class UtilsBinaryTableIOTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(10);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->add_column("c", "double");
+    _table->add_column("d", "long");
+    for (auto row_id = 0; row_id < 1'000; ++row_id) {
+      _table->append({row_id, std::string(row_id % 30, 'x'), row_id * 0.5, int64_t{row_id % 3}});
+    }
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(_file_name);
+  }
+
+  std::shared_ptr<Table> _table;
+  const std::string _file_name = std::filesystem::temp_directory_path() / "hyrise_binary_table_io_test.bin";
+};
+
+TEST_F(UtilsBinaryTableIOTest, ValueSegments) {
+  export_binary_table(_table, _file_name);
+  const auto table = import_binary_table(_file_name);
+
+  EXPECT_EQ(table->target_chunk_size(), 10u);
+  EXPECT_EQ(table->chunk_count(), 100u);
+  EXPECT_EQ(table->column_name(ColumnID{1}), "b");
+  EXPECT_EQ(table->column_type(ColumnID{3}), DataType::Long);
+  EXPECT_TABLE_EQ(*table, *_table, true);
+  const auto segment = table->get_chunk(ChunkID{0})->get_segment(ColumnID{1});
+  EXPECT_NE(std::dynamic_pointer_cast<ValueSegment<std::string>>(segment), nullptr);
+}
+
+TEST_F(UtilsBinaryTableIOTest, DictionarySegmentsKeepTheirEncoding) {
+  _table->compress_chunk(ChunkID{1}, {EncodingType::Dictionary});
+  _table->compress_chunk(ChunkID{5}, {EncodingType::Dictionary});
+  export_binary_table(_table, _file_name);
+
+  TaskScheduler::get().begin(4);
+  const auto table = import_binary_table(_file_name);
+  EXPECT_TABLE_EQ(*table, *_table, true);
+
+  const auto chunk = table->get_chunk(ChunkID{5});
+  const auto string_segment =
+      std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk->get_segment(ColumnID{1}));
+  ASSERT_NE(string_segment, nullptr);
+  EXPECT_EQ(string_segment->unique_values_count(), 10u);
+  EXPECT_EQ(string_segment->get(3), std::string(23, 'x'));
+
+  // three distinct values are stored in a bit-packed attribute vector
+  const auto long_segment = std::dynamic_pointer_cast<DictionarySegment<int64_t>>(chunk->get_segment(ColumnID{3}));
+  ASSERT_NE(long_segment, nullptr);
+  const auto attribute_vector =
+      std::dynamic_pointer_cast<const BitPackedAttributeVector>(long_segment->attribute_vector());
+  ASSERT_NE(attribute_vector, nullptr);
+  EXPECT_EQ(attribute_vector->bits_per_value(), 2u);
+  EXPECT_EQ(long_segment->get(8), int64_t{1});
+}
+
+TEST_F(UtilsBinaryTableIOTest, SharedDictionariesAreStoredOnce) {
+  const auto global_dictionary = build_global_dictionary({{_table, ColumnID{1}}});
+  for (auto chunk_id = ChunkID{0}; chunk_id < 50; ++chunk_id) {
+    _table->compress_chunk(chunk_id, {nullptr, global_dictionary, nullptr, nullptr});
+  }
+  export_binary_table(_table, _file_name);
+  const auto file_size = std::filesystem::file_size(_file_name);
+
+  const auto table = import_binary_table(_file_name);
+  EXPECT_TABLE_EQ(*table, *_table, true);
+  const auto dictionary_of_chunk = [&](const ChunkID chunk_id) {
+    const auto segment = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+        table->get_chunk(chunk_id)->get_segment(ColumnID{1}));
+    return segment ? segment->dictionary() : nullptr;
+  };
+  ASSERT_NE(dictionary_of_chunk(ChunkID{0}), nullptr);
+  EXPECT_EQ(dictionary_of_chunk(ChunkID{0}), dictionary_of_chunk(ChunkID{49}));
+  EXPECT_EQ(dictionary_of_chunk(ChunkID{0})->size(), 30u);
+  EXPECT_EQ(dictionary_of_chunk(ChunkID{50}), nullptr);
+
+  // the dictionary is not written again when the imported table is exported
+  export_binary_table(table, _file_name);
+  EXPECT_EQ(std::filesystem::file_size(_file_name), file_size);
+}
+
+TEST_F(UtilsBinaryTableIOTest, AttributeVectorsReferenceTheMappedFile) {
+  _table->compress_chunk(ChunkID{0}, {EncodingType::Dictionary});
+  export_binary_table(_table, _file_name);
+  const auto table = import_binary_table(_file_name);
+
+  // the imported table stays valid when the file is replaced or removed, as its attribute vectors keep the mapping
+  export_binary_table(_table, _file_name);
+  std::filesystem::remove(_file_name);
+  EXPECT_TABLE_EQ(*table, *_table, true);
+
+  const auto segment =
+      std::dynamic_pointer_cast<DictionarySegment<int32_t>>(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_NE(segment, nullptr);
+  const auto attribute_vector = std::const_pointer_cast<BaseAttributeVector>(segment->attribute_vector());
+  EXPECT_THROW(attribute_vector->set(0, ValueID{1}), std::exception);
+}
+
+TEST_F(UtilsBinaryTableIOTest, RunLengthSegmentsKeepTheirEncoding) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "long");
+  table->add_column("b", "string");
+  for (auto chunk_index = 0; chunk_index < 3; ++chunk_index) {
+    auto long_segment = std::make_shared<ValueSegment<int64_t>>();
+    auto string_segment = std::make_shared<ValueSegment<std::string>>();
+    for (auto row_id = 0; row_id < 100; ++row_id) {
+      long_segment->append(int64_t{row_id / 30});
+      string_segment->append(row_id % 40 < 5 ? NULL_VALUE : AllTypeVariant{std::string(row_id / 40, 'y')});
+    }
+    auto chunk = std::make_unique<Chunk>();
+    chunk->add_segment(std::make_shared<RunLengthSegment<int64_t>>(long_segment));
+    chunk->add_segment(std::make_shared<RunLengthSegment<std::string>>(string_segment));
+    table->emplace_chunk(std::move(chunk));
+  }
+
+  export_binary_table(table, _file_name);
+  const auto imported_table = import_binary_table(_file_name);
+  EXPECT_TABLE_EQ(*imported_table, *table, true);
+
+  const auto string_segment = std::dynamic_pointer_cast<RunLengthSegment<std::string>>(
+      imported_table->get_chunk(ChunkID{2})->get_segment(ColumnID{1}));
+  ASSERT_NE(string_segment, nullptr);
+  EXPECT_EQ(string_segment->values().size(), 6u);
+  EXPECT_TRUE(variant_is_null((*string_segment)[82]));
+}
+
+TEST_F(UtilsBinaryTableIOTest, FrameOfReferenceSegmentsKeepTheirEncoding) {
+  auto table = std::make_shared<Table>(2'000);
+  table->add_column("a", "int");
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  for (auto row_id = 0; row_id < 2'000; ++row_id) {
+    value_segment->append(row_id % 13 == 0 ? NULL_VALUE : AllTypeVariant{row_id * 3 - 1'000});
+  }
+  auto chunk = std::make_unique<Chunk>();
+  chunk->add_segment(std::make_shared<FrameOfReferenceSegment<int32_t>>(value_segment));
+  table->emplace_chunk(std::move(chunk));
+
+  export_binary_table(table, _file_name);
+  const auto imported_table = import_binary_table(_file_name);
+  EXPECT_TABLE_EQ(*imported_table, *table, true);
+  const auto segment = std::dynamic_pointer_cast<FrameOfReferenceSegment<int32_t>>(
+      imported_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_NE(segment, nullptr);
+  EXPECT_EQ(segment->block_minima(), (std::vector<int32_t>{-997, 2'072}));
+}
+
+TEST_F(UtilsBinaryTableIOTest, ReferenceSegmentsAreMaterialized) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 25);
+  table_scan->execute();
+
+  export_binary_table(table_scan->get_output(), _file_name);
+  const auto table = import_binary_table(_file_name);
+  EXPECT_EQ(table->row_count(), 25u);
+  EXPECT_TABLE_EQ(*table, *table_scan->get_output(), true);
+  EXPECT_NE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(table->get_chunk(ChunkID{2})->get_segment(ColumnID{0})),
+            nullptr);
+}
+
+TEST_F(UtilsBinaryTableIOTest, Nulls) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (auto row_id = 0; row_id < 250; ++row_id) {
+    table->append({row_id % 7 == 0 ? NULL_VALUE : AllTypeVariant{row_id}, row_id % 5 == 0 ? NULL_VALUE : "x"});
+  }
+  table->compress_chunk(ChunkID{1}, {EncodingType::Dictionary});
+
+  export_binary_table(table, _file_name);
+  const auto imported_table = import_binary_table(_file_name);
+  EXPECT_TABLE_EQ(*imported_table, *table, true);
+  EXPECT_TRUE(variant_is_null(imported_table->get_chunk(ChunkID{2})->get_segment(ColumnID{0})->operator[](45)));
+}
+
+TEST_F(UtilsBinaryTableIOTest, EmptyTable) {
+  auto empty_table = std::make_shared<Table>();
+  empty_table->add_column("a", "float");
+  export_binary_table(empty_table, _file_name);
+
+  const auto table = import_binary_table(_file_name);
+  EXPECT_EQ(table->column_count(), 1u);
+  EXPECT_EQ(table->row_count(), 0u);
+  EXPECT_EQ(table->chunk_count(), 1u);
+  EXPECT_EQ(table->target_chunk_size(), empty_table->target_chunk_size());
+}
+
+TEST_F(UtilsBinaryTableIOTest, InvalidFiles) {
+  EXPECT_THROW(import_binary_table("src/test/tables/not_existing.bin"), std::exception);
+  EXPECT_THROW(import_binary_table("src/test/tables/int_float.tbl"), std::exception);
+
+  export_binary_table(_table, _file_name);
+  std::filesystem::resize_file(_file_name, std::filesystem::file_size(_file_name) - 1);
+  EXPECT_THROW(import_binary_table(_file_name), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class UtilsLoadTableTest : public BaseTest {
+ protected:
+  void TearDown() override {
+    std::filesystem::remove(_file_name);
+  }
+
+  void _write_file(const std::string& content) {
+    auto file = std::ofstream{_file_name, std::ios::binary};
+    file << content;
+  }
+
+  const std::string _file_name = std::filesystem::temp_directory_path() / "hyrise_load_table_test.tbl";
+};
+
+TEST_F(UtilsLoadTableTest, LoadTable) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+  EXPECT_EQ(table->column_count(), 2u);
+  EXPECT_EQ(table->column_name(ColumnID{0}), "a");
+  EXPECT_EQ(table->column_type(ColumnID{1}), DataType::Float);
+  EXPECT_EQ(table->row_count(), 3u);
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 2u);
+  EXPECT_EQ((*table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))[1], AllTypeVariant{123});
+  EXPECT_EQ((*table->get_chunk(ChunkID{1})->get_segment(ColumnID{1}))[0], AllTypeVariant{457.7f});
+}
+
+TEST_F(UtilsLoadTableTest, LoadTableLikeAppend) {
+  _write_file("a|b|c\r\nlong|string|double\r\n1|hello|1.5\r\n\r\n2.0||-3\r\n3|a b|4e2\r\n");
+  const auto table = load_table(_file_name, 10);
+
+  auto expected_table = Table{10};
+  expected_table.add_column("a", "long");
+  expected_table.add_column("b", "string");
+  expected_table.add_column("c", "double");
+  expected_table.append({int64_t{1}, "hello", 1.5});
+  expected_table.append({int64_t{2}, "", -3.0});
+  expected_table.append({int64_t{3}, "a b", 400.0});
+
+  EXPECT_TABLE_EQ(*table, expected_table, true);
+}
+
+TEST_F(UtilsLoadTableTest, LoadEmptyTable) {
+  _write_file("a\nint\n");
+  const auto table = load_table(_file_name, 10);
+  EXPECT_EQ(table->column_count(), 1u);
+  EXPECT_EQ(table->row_count(), 0u);
+}
+
+TEST_F(UtilsLoadTableTest, LoadLargeTableInParallel) {
+  // the file is larger than the blocks in which row boundaries are searched
+  auto content = std::string{"a|b\nint|string\n"};
+  for (auto row_id = 0; row_id < 500'000; ++row_id) {
+    content += std::to_string(row_id) + "|" + std::to_string(row_id % 7) + "\n";
+  }
+  _write_file(content);
+
+  TaskScheduler::get().begin(4);
+  const auto table = load_table(_file_name, 65'535);
+  EXPECT_EQ(table->row_count(), 500'000u);
+  EXPECT_EQ(table->chunk_count(), 8u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto first_row_id = chunk_id * 65'535;
+    EXPECT_EQ((*chunk->get_segment(ColumnID{0}))[0], AllTypeVariant{static_cast<int32_t>(first_row_id)});
+    EXPECT_EQ((*chunk->get_segment(ColumnID{1}))[chunk->size() - 1],
+              AllTypeVariant{std::to_string((first_row_id + chunk->size() - 1) % 7)});
+  }
+}
+
+TEST_F(UtilsLoadTableTest, InvalidFiles) {
+  EXPECT_THROW(load_table("src/test/tables/not_existing.tbl", 2), std::exception);
+
+  _write_file("a|b\nint|int\n1|2|3\n");
+  EXPECT_THROW(load_table(_file_name, 2), std::exception);
+  _write_file("a|b\nint|int\n1\n");
+  EXPECT_THROW(load_table(_file_name, 2), std::exception);
+  _write_file("a|b\nint|int\nx|1\n");
+  EXPECT_THROW(load_table(_file_name, 2), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,109 @@
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/type_cast.hpp"
+#include "../lib/utils/tpch_table_generator.hpp"
+
+namespace opossum {
+
+class UtilsTpchTableGeneratorTest : public BaseTest {
+ protected:
+  template <typename T>
+  static T _value(const Table& table, const ColumnID column_id, const size_t row_index) {
+    const auto chunk_size = table.target_chunk_size();
+    const auto chunk = table.get_chunk(ChunkID{static_cast<uint32_t>(row_index / chunk_size)});
+    return type_cast<T>((*chunk->get_segment(column_id))[static_cast<ChunkOffset>(row_index % chunk_size)]);
+  }
+};
+
+TEST_F(UtilsTpchTableGeneratorTest, GenerateTables) {
+  generate_tpch_tables(0.01f, 1'000);
+
+  const auto expected_row_counts = std::unordered_map<std::string, uint64_t>{
+      {"region", 5}, {"nation", 25}, {"supplier", 100}, {"customer", 1'500}, {"part", 2'000}, {"partsupp", 8'000},
+      {"orders", 15'000}};
+  for (const auto& table_name : tpch_table_names()) {
+    ASSERT_TRUE(StorageManager::get().has_table(table_name));
+    const auto table = StorageManager::get().get_table(table_name);
+    if (expected_row_counts.contains(table_name)) {
+      EXPECT_EQ(table->row_count(), expected_row_counts.at(table_name));
+    }
+
+    // all chunks but the last one are full
+    for (auto chunk_id = ChunkID{0}; chunk_id + 1 < table->chunk_count(); ++chunk_id) {
+      EXPECT_EQ(table->get_chunk(chunk_id)->size(), 1'000u);
+    }
+  }
+
+  // orders have one to seven line items
+  const auto lineitem = StorageManager::get().get_table("lineitem");
+  EXPECT_GE(lineitem->row_count(), 15'000u);
+  EXPECT_LE(lineitem->row_count(), 105'000u);
+  EXPECT_EQ(lineitem->column_name(ColumnID{10}), "l_shipdate");
+  EXPECT_EQ(lineitem->column_type(ColumnID{5}), DataType::Double);
+}
+
+TEST_F(UtilsTpchTableGeneratorTest, ConsistentValues) {
+  const auto orders = generate_tpch_table("orders", 0.001f, 100);
+  const auto lineitem = generate_tpch_table("lineitem", 0.001f, 100);
+
+  // The line items of an order follow each other with increasing line numbers and sum up to the total price.
+  auto row_index = size_t{0};
+  for (auto order_index = size_t{0}; order_index < orders->row_count(); ++order_index) {
+    const auto order_key = _value<int32_t>(*orders, ColumnID{0}, order_index);
+    const auto customer_key = _value<int32_t>(*orders, ColumnID{1}, order_index);
+    EXPECT_GE(customer_key, 1);
+    EXPECT_NE(customer_key % 3, 0);
+    EXPECT_LE(customer_key, 150);
+
+    auto total_price = 0.0;
+    auto line_number = 1;
+    while (row_index < lineitem->row_count() && _value<int32_t>(*lineitem, ColumnID{0}, row_index) == order_key) {
+      EXPECT_EQ(_value<int32_t>(*lineitem, ColumnID{3}, row_index), line_number);
+      const auto part_key = _value<int32_t>(*lineitem, ColumnID{1}, row_index);
+      EXPECT_GE(part_key, 1);
+      EXPECT_LE(part_key, 200);
+      EXPECT_GT(_value<std::string>(*lineitem, ColumnID{10}, row_index),
+                _value<std::string>(*orders, ColumnID{4}, order_index));
+      total_price += _value<double>(*lineitem, ColumnID{5}, row_index) *
+                     (1 + _value<double>(*lineitem, ColumnID{7}, row_index)) *
+                     (1 - _value<double>(*lineitem, ColumnID{6}, row_index));
+      ++line_number;
+      ++row_index;
+    }
+    EXPECT_GE(line_number, 2);
+    EXPECT_LE(line_number, 8);
+    EXPECT_NEAR(_value<double>(*orders, ColumnID{3}, order_index), total_price, 0.01);
+  }
+  EXPECT_EQ(row_index, lineitem->row_count());
+
+  EXPECT_EQ(_value<int32_t>(*orders, ColumnID{0}, 8), 33);
+  EXPECT_EQ(_value<std::string>(*generate_tpch_table("supplier", 0.001f), ColumnID{1}, 9), "Supplier#000000010");
+  EXPECT_EQ(_value<std::string>(*generate_tpch_table("nation", 0.001f), ColumnID{1}, 24), "UNITED STATES");
+}
+
+TEST_F(UtilsTpchTableGeneratorTest, Reproducible) {
+  // the tables neither depend on the chunk size nor on the number of threads
+  const auto lineitem = generate_tpch_table("lineitem", 0.001f, 1'000);
+  TaskScheduler::get().begin(4);
+  for (const auto& table_name : tpch_table_names()) {
+    EXPECT_TABLE_EQ(generate_tpch_table(table_name, 0.001f, 1'000), generate_tpch_table(table_name, 0.001f, 333),
+                    true);
+  }
+  EXPECT_TABLE_EQ(generate_tpch_table("lineitem", 0.001f, 1'000), lineitem, true);
+}
+
+TEST_F(UtilsTpchTableGeneratorTest, InvalidArguments) {
+  EXPECT_THROW(generate_tpch_table("lineorder", 1.0f), std::exception);
+  EXPECT_THROW(generate_tpch_table("orders", 0.0f), std::exception);
+  EXPECT_THROW(generate_tpch_table("orders", 0.01f, 0), std::exception);
+}
+
+}  // namespace opossum